@@ -1,3 +1,319 @@
-//
-// Created by PC on 12/7/2024.
-//
+#include <iostream>
+#include <cmath>
+#include <climits>
+#include <algorithm>
+using namespace std;
+
+/**
+ * The number of landmarks LandmarkHeuristic picks unless told otherwise. More landmarks give tighter bounds
+ * at the cost of two full searches and 8 bytes per vertex each.
+ */
+constexpr int DEFAULT_LANDMARK_COUNT = 8;
+
+/**
+ * The heuristic that knows nothing: every estimate is zero, so A* settles vertices in exactly the order of
+ * dijkstraPath. Useful as a baseline when measuring the other heuristics.
+ */
+struct ZeroHeuristic {
+    /**
+     * Estimates the remaining distance from a vertex to the target.
+     * @return Always 0.
+     */
+    float estimate(const int, const int) const {
+        return 0;
+    }
+};
+
+/**
+ * A lower bound on travel time from the straight-line distance between intersections.
+ *
+ * The travel time of a road is at least its length divided by the fastest speed seen on any road, so the
+ * straight-line distance to the target divided by that speed never overestimates the remaining time. The
+ * speed is derived from the graph itself when the heuristic is built, which makes the bound admissible and
+ * consistent for the weights it was built from. Raising weights afterwards keeps it valid; lowering them
+ * requires a rebuild.
+ */
+class CoordinateHeuristic {
+    /**
+     * The x coordinate of each vertex.
+     */
+    Vector<float> xs;
+    /**
+     * The y coordinate of each vertex.
+     */
+    Vector<float> ys;
+    /**
+     * The smallest travel time per unit of distance over all roads.
+     */
+    float timePerDistance;
+
+public:
+    /**
+     * Builds the heuristic for a graph whose intersections have coordinates.
+     *
+     * @param network The CSR snapshot whose weights the estimates must not exceed.
+     * @param x The x coordinate of every vertex of the snapshot.
+     * @param y The y coordinate of every vertex of the snapshot.
+     */
+    CoordinateHeuristic(const CSRGraph &network, const Vector<float> &x, const Vector<float> &y)
+        : xs(x), ys(y), timePerDistance(INF) {
+        for (int u = 0; u < network.getSize(); u++) {
+            for (int e = network.edgeBegin(u); e < network.edgeEnd(u); e++) {
+                const int v = network.getTarget(e);
+                const float length = hypotf(xs[v] - xs[u], ys[v] - ys[u]);
+                if (length > 0 && network.getWeight(e) / length < timePerDistance) {
+                    timePerDistance = network.getWeight(e) / length;
+                }
+            }
+        }
+        if (timePerDistance == INF) timePerDistance = 0; // No road has a length, so nothing can be bounded
+    }
+
+    /**
+     * Estimates the remaining travel time from a vertex to the target.
+     *
+     * @param vertex The vertex the estimate is for.
+     * @param target The destination of the search.
+     * @return A lower bound on the travel time from vertex to target.
+     */
+    float estimate(const int vertex, const int target) const {
+        return hypotf(xs[target] - xs[vertex], ys[target] - ys[vertex]) * timePerDistance;
+    }
+};
+
+/**
+ * Computes the distance from a source to every vertex, or from every vertex to the source, ignoring closures.
+ *
+ * @param network The CSR snapshot to search.
+ * @param source The vertex the distances are measured from (or to).
+ * @param backward False to follow edges forwards (distances from the source), true to follow them backwards
+ *                 through the reverse CSR (distances to the source).
+ * @param distance Filled with one distance per vertex, or INF for vertices that are not connected.
+ */
+void allDistances(const CSRGraph &network, const int source, const bool backward, Vector<float> &distance) {
+    distance = Vector<float>(network.getSize(), INF);
+    FrontierHeap frontier;
+    frontier.ensureCapacity(network.getSize());
+    distance[source] = 0;
+    frontier.push(source, 0);
+
+    // Weights are non-negative, so a vertex never improves after it leaves the frontier
+    while (!frontier.isEmpty()) {
+        const int u = frontier.extractMin();
+        const int first = backward ? network.inEdgeBegin(u) : network.edgeBegin(u);
+        const int last = backward ? network.inEdgeEnd(u) : network.edgeEnd(u);
+        for (int e = first; e < last; e++) {
+            const int v = backward ? network.getSource(e) : network.getTarget(e);
+            const float candidate = distance[u] + (backward ? network.getInWeight(e) : network.getWeight(e));
+            if (candidate < distance[v]) {
+                distance[v] = candidate;
+                frontier.pushOrDecrease(v, candidate);
+            }
+        }
+    }
+}
+
+/**
+ * Lower bounds from landmarks and the triangle inequality (ALT), for graphs without coordinates.
+ *
+ * A few landmark intersections are picked far apart from each other, and the distances from and to each of
+ * them are computed once. For any landmark L, d(v, t) >= d(L, t) - d(L, v) and d(v, t) >= d(v, L) - d(t, L);
+ * the estimate is the largest of these bounds. Landmarks on the far side of the target give tight bounds, so
+ * A* heads for the target instead of spreading out in every direction.
+ *
+ * The distances ignore road closures. Closures only remove roads, which can only make routes longer, so the
+ * bounds stay admissible and consistent under any set of closures, and also after weights are raised. Adding
+ * roads or lowering weights requires a rebuild.
+ */
+class LandmarkHeuristic {
+    /**
+     * The landmark vertices.
+     */
+    Vector<int> landmarks;
+    /**
+     * The distance from each landmark to each vertex, stored vertex by vertex: entry v * count + i is d(L_i, v).
+     */
+    Vector<float> fromLandmark;
+    /**
+     * The distance from each vertex to each landmark, stored like fromLandmark: entry v * count + i is d(v, L_i).
+     */
+    Vector<float> toLandmark;
+    /**
+     * The number of landmarks.
+     */
+    int count;
+
+public:
+    /**
+     * Picks the landmarks and computes their distances.
+     *
+     * Landmarks are chosen by farthest-point selection: the first is the vertex farthest from vertex 0, and each
+     * next one is the vertex whose distance to the nearest landmark chosen so far is largest. The search that
+     * measures those distances also provides the forward distances of each landmark.
+     *
+     * @param network The CSR snapshot whose weights the estimates must not exceed.
+     * @param landmarkCount The number of landmarks to pick. Fewer are picked if the graph runs out of vertices.
+     */
+    explicit LandmarkHeuristic(const CSRGraph &network, const int landmarkCount = DEFAULT_LANDMARK_COUNT) : count(0) {
+        const int n = network.getSize();
+        if (n == 0 || landmarkCount <= 0) return;
+
+        Vector<float> distance;
+        Vector<float> nearest(n, INF);
+        Vector<Vector<float>> forward;
+        Vector<Vector<float>> backward;
+        allDistances(network, 0, false, distance);
+        while (landmarks.getSize() < landmarkCount && landmarks.getSize() < n) {
+            // The farthest reachable vertex from what has been covered so far; on the first round, from vertex 0
+            const Vector<float> &coverage = landmarks.isEmpty() ? distance : nearest;
+            int next = -1;
+            for (int v = 0; v < n; v++) {
+                if (coverage[v] < INF && landmarks.find(v) == -1 && (next == -1 || coverage[v] > coverage[next])) {
+                    next = v;
+                }
+            }
+            if (next == -1) break;
+
+            landmarks.push_back(next);
+            allDistances(network, next, false, distance);
+            forward.push_back(distance);
+            allDistances(network, next, true, distance);
+            backward.push_back(distance);
+            for (int v = 0; v < n; v++) {
+                nearest[v] = min(nearest[v], forward[forward.getSize() - 1][v]);
+            }
+        }
+
+        count = landmarks.getSize();
+        fromLandmark = Vector<float>(n * count);
+        toLandmark = Vector<float>(n * count);
+        for (int v = 0; v < n; v++) {
+            for (int i = 0; i < count; i++) {
+                fromLandmark[v * count + i] = forward[i][v];
+                toLandmark[v * count + i] = backward[i][v];
+            }
+        }
+    }
+
+    /**
+     * Estimates the remaining travel time from a vertex to the target.
+     *
+     * @param vertex The vertex the estimate is for.
+     * @param target The destination of the search.
+     * @return A lower bound on the travel time from vertex to target.
+     */
+    float estimate(const int vertex, const int target) const {
+        const float *fromVertex = fromLandmark.begin() + vertex * count;
+        const float *fromTarget = fromLandmark.begin() + target * count;
+        const float *toVertex = toLandmark.begin() + vertex * count;
+        const float *toTarget = toLandmark.begin() + target * count;
+        float bound = 0;
+        for (int i = 0; i < count; i++) {
+            // A landmark that cannot reach (or be reached from) one of the two vertices bounds nothing
+            if (fromVertex[i] < INF && fromTarget[i] < INF) {
+                bound = max(bound, fromTarget[i] - fromVertex[i]);
+            }
+            if (toVertex[i] < INF && toTarget[i] < INF) {
+                bound = max(bound, toVertex[i] - toTarget[i]);
+            }
+        }
+        return bound;
+    }
+
+    /**
+     * Returns the landmarks that were picked.
+     * @return The landmark vertices, in the order they were picked.
+     */
+    const Vector<int> &getLandmarks() const {
+        return landmarks;
+    }
+};
+
+/**
+ * Computes the shortest path from a start node to an end node with A*, avoiding the compiled road closures.
+ *
+ * Like dijkstraPath, but the frontier is ordered by the distance so far plus the heuristic's lower bound on the
+ * remaining distance, so the search is drawn towards the destination and settles far fewer vertices. Any
+ * consistent heuristic (ZeroHeuristic, CoordinateHeuristic, LandmarkHeuristic) gives a shortest path; where
+ * several paths tie, the one returned may differ from dijkstraPath's.
+ *
+ * @param network The CSR snapshot of the graph to search.
+ * @param start The starting node of the path search.
+ * @param end The destination node of the path search.
+ * @param closures The compiled road closures to avoid, as returned by compileRoadClosures.
+ * @param heuristic Provides estimate(vertex, target), a lower bound on the remaining distance.
+ * @param workspace The scratch state to run the search in.
+ * @param settledCount If not null, receives the number of vertices the search settled.
+ * @return The shortest path from start to end, or an empty route if no path is found.
+ */
+template<typename Heuristic>
+Route astarPath(const CSRGraph &network, const int start, const int end, const EdgeMap<int> &closures,
+                const Heuristic &heuristic, SearchWorkspace &workspace, int *settledCount = nullptr) {
+    if (settledCount != nullptr) *settledCount = 0;
+    if (start < 0 || end < 0 || start >= network.getSize() || end >= network.getSize()) {
+        return Route();
+    }
+
+    workspace.begin(network.getSize());
+    workspace.relax(start, 0, -1, heuristic.estimate(start, end));
+
+    int settled = 0;
+    FrontierHeap &frontier = workspace.getFrontier();
+    while (!frontier.isEmpty()) {
+        int u = frontier.extractMin();
+        if (u == end) break;
+
+        workspace.settle(u);
+        settled++;
+        float distanceU = workspace.getDistance(u);
+
+        for (int e = network.edgeBegin(u); e < network.edgeEnd(u); e++) {
+            int v = network.getTarget(e);
+            float weight = network.getWeight(e);
+
+            // Skip the edge if it's blocked
+            if (isBlockedEdge(closures, u, v)) {
+                continue;
+            }
+
+            if (!workspace.isSettled(v) && distanceU + weight < workspace.getDistance(v)) {
+                workspace.relax(v, distanceU + weight, u, distanceU + weight + heuristic.estimate(v, end));
+            }
+        }
+    }
+
+    if (settledCount != nullptr) *settledCount = settled;
+    return tracePath(workspace, start, end);
+}
+
+/**
+ * Routes every emergency vehicle twice, with Dijkstra (A* with ZeroHeuristic) and with A* guided by landmarks,
+ * and prints how many vertices each search settled per route on average.
+ *
+ * @param graph The graph to route on.
+ * @param emergencyVehicles The emergency vehicles, whose start and end columns are routed.
+ * @param roadClosures The road closures to avoid.
+ */
+void compareEmergencyRouting(const Graph &graph, const EmergencyVehicleTable &emergencyVehicles, const ClosureTable &roadClosures) {
+    if (emergencyVehicles.getSize() == 0) return;
+
+    const CSRGraph &network = graph.getSnapshot();
+    const EdgeMap<int> closures = compileRoadClosures(roadClosures);
+    const ZeroHeuristic zero;
+    const LandmarkHeuristic landmarks(network);
+    SearchWorkspace &workspace = threadWorkspace();
+
+    long long dijkstraSettled = 0;
+    long long landmarkSettled = 0;
+    for (int i = 0; i < emergencyVehicles.getSize(); i++) {
+        int settled;
+        astarPath(network, emergencyVehicles.getStart(i), emergencyVehicles.getEnd(i), closures, zero, workspace, &settled);
+        dijkstraSettled += settled;
+        astarPath(network, emergencyVehicles.getStart(i), emergencyVehicles.getEnd(i), closures, landmarks, workspace, &settled);
+        landmarkSettled += settled;
+    }
+
+    const double routes = emergencyVehicles.getSize();
+    cout << "Emergency routes: " << emergencyVehicles.getSize() << " - Vertices settled per route - Dijkstra: "
+         << dijkstraSettled / routes << " - A* (landmarks): " << landmarkSettled / routes << endl;
+}
@@ -0,0 +1,221 @@
+#include <iostream>
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+using namespace std;
+
+/**
+ * An immutable compressed sparse row (CSR) snapshot of a graph.
+ *
+ * The outgoing edges of vertex u occupy the index range [offsets[u], offsets[u + 1]) of the targets and
+ * weights arrays, so a full adjacency scan reads contiguous memory instead of chasing list nodes across
+ * the heap. The snapshot is built from the adjacency lists of a Graph in a single pass and is never
+ * modified afterwards; Graph rebuilds it when the mutable adjacency lists change.
+ *
+ * The snapshot also holds the transposed graph in the same layout: the incoming edges of vertex v occupy
+ * [reverseOffsets[v], reverseOffsets[v + 1]) of the sources and reverseWeights arrays. Backward searches
+ * (from a destination towards the origins) and bidirectional searches scan these ranges.
+ */
+class CSRGraph {
+    /**
+     * The index of the first outgoing edge of each vertex, plus a final entry holding the edge count.
+     */
+    Vector<int> offsets;
+    /**
+     * The target vertex of every edge, grouped by source vertex.
+     */
+    Vector<int> targets;
+    /**
+     * The weight of every edge, parallel to targets.
+     */
+    Vector<float> weights;
+    /**
+     * The index of the first incoming edge of each vertex, plus a final entry holding the edge count.
+     */
+    Vector<int> reverseOffsets;
+    /**
+     * The source vertex of every edge, grouped by target vertex and ordered by source within a group.
+     */
+    Vector<int> sources;
+    /**
+     * The weight of every edge, parallel to sources.
+     */
+    Vector<float> reverseWeights;
+    /**
+     * The number of vertices in the snapshot.
+     */
+    int numVertices;
+
+public:
+    /**
+     * Constructs an empty snapshot with no vertices.
+     */
+    CSRGraph() : offsets(1, 0), reverseOffsets(1, 0), numVertices(0) {}
+
+    /**
+     * Rebuilds the snapshot from a set of adjacency lists, keeping the order of each list.
+     * The reverse arrays are then filled by a counting sort of the edges by target.
+     *
+     * @param adjacency The adjacency list of every vertex.
+     * @param nVert The number of vertices, i.e. the number of adjacency lists to read.
+     */
+    void build(const Vector<LinkedList> &adjacency, const int nVert) {
+        numVertices = nVert;
+        offsets = Vector<int>(nVert + 1, 0);
+        targets.clear();
+        weights.clear();
+
+        for (int u = 0; u < nVert; u++) {
+            offsets[u] = targets.getSize();
+            for (const Node &edge : adjacency[u]) {
+                targets.push_back(edge.data);
+                weights.push_back(edge.weight);
+            }
+        }
+        offsets[nVert] = targets.getSize();
+
+        // Count the incoming edges of every vertex and turn the counts into start offsets
+        const int edgeCount = targets.getSize();
+        if (reverseOffsets.getSize() != nVert + 1) {
+            reverseOffsets = Vector<int>(nVert + 1, 0);
+        } else {
+            std::fill(reverseOffsets.begin(), reverseOffsets.end(), 0);
+        }
+        for (const int target : targets) {
+            reverseOffsets[target + 1]++;
+        }
+        for (int v = 0; v < nVert; v++) {
+            reverseOffsets[v + 1] += reverseOffsets[v];
+        }
+
+        // The storage is reused between rebuilds as long as the edge count stays the same
+        if (sources.getSize() != edgeCount) {
+            sources = Vector<int>(edgeCount);
+            reverseWeights = Vector<float>(edgeCount);
+        }
+
+        // Scatter the edges, using the start offsets as cursors; afterwards offset v holds the start of v + 1
+        for (int u = 0; u < nVert; u++) {
+            for (int e = offsets[u]; e < offsets[u + 1]; e++) {
+                const int slot = reverseOffsets[targets[e]]++;
+                sources[slot] = u;
+                reverseWeights[slot] = weights[e];
+            }
+        }
+        for (int v = nVert; v > 0; v--) {
+            reverseOffsets[v] = reverseOffsets[v - 1];
+        }
+        reverseOffsets[0] = 0;
+    }
+
+    /**
+     * Returns the number of vertices in the snapshot.
+     * @return The number of vertices.
+     */
+    int getSize() const {
+        return numVertices;
+    }
+
+    /**
+     * Returns the number of edges in the snapshot.
+     * @return The number of edges.
+     */
+    int getEdgeCount() const {
+        return targets.getSize();
+    }
+
+    /**
+     * Returns the index of the first outgoing edge of a vertex.
+     *
+     * @param vertex The source vertex.
+     * @return The first edge index of the vertex.
+     */
+    int edgeBegin(const int vertex) const {
+        return offsets[vertex];
+    }
+
+    /**
+     * Returns the index one past the last outgoing edge of a vertex.
+     *
+     * @param vertex The source vertex.
+     * @return The end edge index of the vertex.
+     */
+    int edgeEnd(const int vertex) const {
+        return offsets[vertex + 1];
+    }
+
+    /**
+     * Returns the target vertex of an edge.
+     *
+     * @param edge The edge index.
+     * @return The vertex the edge leads to.
+     */
+    int getTarget(const int edge) const {
+        return targets[edge];
+    }
+
+    /**
+     * Returns the weight of an edge.
+     *
+     * @param edge The edge index.
+     * @return The travel time of the edge.
+     */
+    float getWeight(const int edge) const {
+        return weights[edge];
+    }
+
+    /**
+     * Finds an edge between two vertices by scanning the outgoing edges of the source.
+     *
+     * @param u The source vertex.
+     * @param v The target vertex.
+     * @return The index of the first edge from u to v, or -1 if there is none.
+     */
+    int findEdge(const int u, const int v) const {
+        for (int e = offsets[u]; e < offsets[u + 1]; e++) {
+            if (targets[e] == v) return e;
+        }
+        return -1;
+    }
+
+    /**
+     * Returns the index of the first incoming edge of a vertex in the reverse arrays.
+     *
+     * @param vertex The target vertex.
+     * @return The first reverse edge index of the vertex.
+     */
+    int inEdgeBegin(const int vertex) const {
+        return reverseOffsets[vertex];
+    }
+
+    /**
+     * Returns the index one past the last incoming edge of a vertex in the reverse arrays.
+     *
+     * @param vertex The target vertex.
+     * @return The end reverse edge index of the vertex.
+     */
+    int inEdgeEnd(const int vertex) const {
+        return reverseOffsets[vertex + 1];
+    }
+
+    /**
+     * Returns the source vertex of an incoming edge.
+     *
+     * @param edge The reverse edge index.
+     * @return The vertex the edge comes from.
+     */
+    int getSource(const int edge) const {
+        return sources[edge];
+    }
+
+    /**
+     * Returns the weight of an incoming edge.
+     *
+     * @param edge The reverse edge index.
+     * @return The travel time of the edge.
+     */
+    float getInWeight(const int edge) const {
+        return reverseWeights[edge];
+    }
+};
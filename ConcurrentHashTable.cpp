@@ -0,0 +1,496 @@
+#include <iostream>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <functional>
+
+using namespace std;
+
+/**
+ * A congestion table like HashTable that many threads can update at once.
+ *
+ * Every road owns a record with its key and both counts packed into one 64-bit atomic (regular count in the
+ * low 32 bits, emergency count in the high 32 bits). Records live in a NodePool and never move, so counting a
+ * trip is a lock-free lookup followed by a relaxed fetch_add on the record; no thread ever waits for another
+ * to update a count.
+ *
+ * The lookup table (an Index of record pointers, with linear probing exactly as in HashTable) is read without
+ * locks. Inserting or removing roads takes a mutex. Growing the table builds a new Index beside the old one and
+ * publishes it with one atomic store; the old Index is freed only after every reader that might still be
+ * probing it has finished. Readers announce themselves in per-thread counters split by epoch (the scheme of
+ * sleepable RCU), so entering and leaving a lookup costs two uncontended atomic operations and never blocks.
+ * Removed records are freed after the same grace period.
+ *
+ * The slot layout follows HashTable's exactly, so both tables list the same roads in the same order.
+ */
+class ConcurrentHashTable {
+public:
+    /**
+     * The counts of one road, as returned by snapshot.
+     */
+    struct RoadCounts {
+        int u;
+        int v;
+        int regularCount;
+        int emergencyCount;
+    };
+
+private:
+    /**
+     * The number of slots a newly constructed table starts with. Always a power of two.
+     */
+    static constexpr int INITIAL_SIZE = 64;
+    /**
+     * The key of the marker that takes the place of a removed road.
+     */
+    static constexpr long long DELETED_KEY = -2;
+    /**
+     * The number of reader counters. Threads are spread over them so that readers rarely share a cache line.
+     */
+    static constexpr int READER_SLOTS = 64;
+    /**
+     * The amount added to the packed counts for one regular trip.
+     */
+    static constexpr unsigned long long REGULAR_UNIT = 1;
+    /**
+     * The amount added to the packed counts for one emergency trip.
+     */
+    static constexpr unsigned long long EMERGENCY_UNIT = 1ULL << 32;
+
+    /**
+     * A road and its counts. Records are never moved while any reader may see them.
+     */
+    struct Road {
+        /**
+         * The road (u, v) packed by edgeKey, or DELETED_KEY for the removal marker.
+         */
+        long long key;
+        /**
+         * The emergency count in the high 32 bits and the regular count in the low 32 bits.
+         */
+        atomic<unsigned long long> counts;
+
+        explicit Road(const long long roadKey) : key(roadKey), counts(0) {}
+    };
+
+    /**
+     * A lookup table of road records. Each slot holds nullptr (empty), the removal marker, or a road.
+     */
+    struct Index {
+        Vector<atomic<Road *>> slots;
+        int mask;
+
+        explicit Index(const int size) : slots(size), mask(size - 1) {}
+    };
+
+    /**
+     * The number of readers inside a lookup, per epoch parity, for the threads mapped to this counter.
+     * Padded to a cache line so threads on different counters do not slow each other down.
+     */
+    struct alignas(64) ReaderSlot {
+        atomic<int> active[2];
+
+        ReaderSlot() {
+            active[0].store(0);
+            active[1].store(0);
+        }
+    };
+
+    /**
+     * Marks a reader as active from construction until destruction. Readers may load the current Index and
+     * use any record they find in it for as long as the section lasts.
+     */
+    class ReadSection {
+        atomic<int> &counter;
+
+    public:
+        explicit ReadSection(const ConcurrentHashTable &table) : counter(table.enterRead()) {}
+
+        ReadSection(const ReadSection &) = delete;
+        ReadSection &operator=(const ReadSection &) = delete;
+
+        ~ReadSection() {
+            counter.fetch_sub(1, memory_order_release);
+        }
+    };
+
+    /**
+     * The current lookup table.
+     */
+    atomic<Index *> index;
+    /**
+     * The storage of every road record.
+     */
+    NodePool<Road> roads;
+    /**
+     * Records removed since the last grace period. They are freed once no reader can still hold them.
+     */
+    Vector<Road *> retired;
+    /**
+     * The marker stored in the slot of a removed road. Probe sequences continue past it.
+     */
+    Road removed;
+    /**
+     * The reader counters. Mutable because readers announce themselves from const methods too.
+     */
+    mutable ReaderSlot readers[READER_SLOTS];
+    /**
+     * The current epoch. New readers count themselves under its parity.
+     */
+    atomic<unsigned int> epoch;
+    /**
+     * Serialises the threads that add, remove or relocate roads. Readers and count updates never take it.
+     */
+    mutex writeLock;
+    /**
+     * The number of live roads.
+     */
+    atomic<int> occupied;
+    /**
+     * The number of slots holding the removal marker. Only changed under writeLock.
+     */
+    int tombstones;
+    /**
+     * The share of slots (live roads plus tombstones) above which the table is rehashed.
+     */
+    float maxLoadFactor;
+
+    /**
+     * Returns the reader counter the calling thread uses, fixed for the lifetime of the thread.
+     * @return An index into readers.
+     */
+    static int readerSlot() {
+        thread_local const int slot = static_cast<int>(hash<thread::id>()(this_thread::get_id()) % READER_SLOTS);
+        return slot;
+    }
+
+    /**
+     * Registers the calling thread as a reader under the current epoch.
+     *
+     * @return The counter to decrement when the read ends.
+     */
+    atomic<int> &enterRead() const {
+        atomic<int> &counter = readers[readerSlot()].active[epoch.load() & 1];
+        counter.fetch_add(1);
+        return counter;
+    }
+
+    /**
+     * Waits until every reader that might still see an Index or record unlinked before the call has finished.
+     *
+     * Each pass flips the epoch, so new readers count themselves under the other parity, and waits for the old
+     * parity to drain. A reader that read the epoch just before a flip may still register under the old parity
+     * after it drained; it then sees only the new Index, and the second pass waits for it anyway.
+     */
+    void waitForReaders() {
+        for (int pass = 0; pass < 2; pass++) {
+            const unsigned int parity = epoch.fetch_add(1) & 1;
+            for (ReaderSlot &slot : readers) {
+                while (slot.active[parity].load() != 0) {
+                    this_thread::yield();
+                }
+            }
+        }
+    }
+
+    /**
+     * Computes the home slot of a key in an Index.
+     *
+     * @param current The lookup table.
+     * @param key The road key.
+     * @return The slot where the probe sequence for the key starts.
+     */
+    static int homeSlot(const Index &current, const long long key) {
+        return static_cast<int>(mixKey(static_cast<unsigned long long>(key)) & current.mask);
+    }
+
+    /**
+     * Finds the record of a road without locking. Must be called inside a ReadSection.
+     *
+     * @param u The first node identifier.
+     * @param v The second node identifier.
+     * @return The record, or nullptr (after printing a message) if the road is not in the table.
+     */
+    Road *findRoad(const int u, const int v) const {
+        const long long key = static_cast<long long>(edgeKey(u, v));
+        const Index &current = *index.load();
+        int slot = homeSlot(current, key);
+        for (Road *road = current.slots[slot].load(memory_order_acquire); road != nullptr;
+             road = current.slots[slot].load(memory_order_acquire)) {
+            if (road->key == key) return road;
+            slot = (slot + 1) & current.mask;
+        }
+        cout << "Road (" << u << ", " << v << ") not found in hash table." << endl;
+        return nullptr;
+    }
+
+    /**
+     * Moves every live road into a new Index of the given size, dropping all tombstones, then frees the old
+     * Index and the retired records once no reader can still use them. Must be called with writeLock held.
+     *
+     * @param newSize The new number of slots. Must be a power of two larger than the number of live roads.
+     */
+    void rehash(const int newSize) {
+        Index *old = index.load(memory_order_relaxed);
+        Index *fresh = new Index(newSize);
+        for (const atomic<Road *> &entry : old->slots) {
+            Road *road = entry.load(memory_order_relaxed);
+            if (road != nullptr && road != &removed) {
+                int slot = homeSlot(*fresh, road->key);
+                while (fresh->slots[slot].load(memory_order_relaxed) != nullptr) {
+                    slot = (slot + 1) & fresh->mask;
+                }
+                fresh->slots[slot].store(road, memory_order_relaxed);
+            }
+        }
+        index.store(fresh);
+        tombstones = 0;
+
+        waitForReaders();
+        delete old;
+        for (Road *road : retired) {
+            roads.destroy(road);
+        }
+        retired.clear();
+    }
+
+    /**
+     * Extracts one count from packed counts.
+     *
+     * @param counts The packed counts.
+     * @param isEmergency True for the emergency count, false for the regular count.
+     * @return The count.
+     */
+    static int unpack(const unsigned long long counts, const bool isEmergency) {
+        return static_cast<int>(isEmergency ? counts >> 32 : counts & 0xffffffffULL);
+    }
+
+public:
+    /**
+     * Constructs a new, empty table.
+     *
+     * @param loadFactorLimit The share of used slots above which the table is rehashed. Values outside
+     *                        [0.1, 0.95] are clamped to that range.
+     */
+    explicit ConcurrentHashTable(const float loadFactorLimit = 0.7f)
+        : index(new Index(INITIAL_SIZE)), removed(DELETED_KEY), epoch(0), occupied(0), tombstones(0),
+          maxLoadFactor(loadFactorLimit) {
+        if (maxLoadFactor < 0.1f) maxLoadFactor = 0.1f;
+        if (maxLoadFactor > 0.95f) maxLoadFactor = 0.95f;
+    }
+
+    ConcurrentHashTable(const ConcurrentHashTable &) = delete;
+    ConcurrentHashTable &operator=(const ConcurrentHashTable &) = delete;
+
+    /**
+     * Destructor. Frees the lookup table and every record. No other thread may be using the table.
+     */
+    ~ConcurrentHashTable() {
+        delete index.load();
+    }
+
+    /**
+     * Inserts a road connection between nodes u and v with both counts at zero. Inserting a road that is
+     * already present has no effect. Safe to call while other threads read and update counts.
+     *
+     * @param u The first node identifier.
+     * @param v The second node identifier.
+     */
+    void insert(int u, int v) {
+        lock_guard<mutex> guard(writeLock);
+        int size = index.load(memory_order_relaxed)->slots.getSize();
+        if (static_cast<float>(occupied + tombstones + 1) > maxLoadFactor * size) {
+            // Grow only if live roads need the room; otherwise rehashing at the same size clears the tombstones
+            const bool crowded = static_cast<float>(occupied + 1) > maxLoadFactor * size / 2;
+            rehash(crowded ? size * 2 : size);
+        }
+
+        Index &current = *index.load(memory_order_relaxed);
+        const long long key = static_cast<long long>(edgeKey(u, v));
+        int slot = homeSlot(current, key);
+        int firstTombstone = -1;
+        for (Road *road = current.slots[slot].load(memory_order_relaxed); road != nullptr;
+             road = current.slots[slot].load(memory_order_relaxed)) {
+            if (road->key == key) return;
+            if (road == &removed && firstTombstone == -1) {
+                firstTombstone = slot;
+            }
+            slot = (slot + 1) & current.mask;
+        }
+
+        if (firstTombstone != -1) {
+            slot = firstTombstone;
+            tombstones--;
+        }
+        // Publish the record only once it is fully built
+        current.slots[slot].store(roads.create(key), memory_order_release);
+        occupied++;
+    }
+
+    /**
+     * Removes a road, printing a message if it does not exist. Trips counted on the road by threads that found
+     * it just before the removal are dropped with it. Safe to call while other threads read and update counts.
+     *
+     * @param u The first endpoint of the road.
+     * @param v The second endpoint of the road.
+     */
+    void remove(int u, int v) {
+        lock_guard<mutex> guard(writeLock);
+        Index &current = *index.load(memory_order_relaxed);
+        const long long key = static_cast<long long>(edgeKey(u, v));
+        int slot = homeSlot(current, key);
+        for (Road *road = current.slots[slot].load(memory_order_relaxed); road != nullptr;
+             road = current.slots[slot].load(memory_order_relaxed)) {
+            if (road->key == key) {
+                current.slots[slot].store(&removed, memory_order_release);
+                retired.push_back(road);
+                occupied--;
+                tombstones++;
+                return;
+            }
+            slot = (slot + 1) & current.mask;
+        }
+        cout << "Road (" << u << ", " << v << ") not found in hash table." << endl;
+    }
+
+    /**
+     * Retrieves the regular or emergency count of a road without locking.
+     *
+     * @param u The first endpoint of the road.
+     * @param v The second endpoint of the road.
+     * @param isEmergency A boolean flag to specify if the search is for an emergency count.
+     * @return The count for the specified road, or -1 if the road is not found.
+     */
+    int search(int u, int v, bool isEmergency) const {
+        ReadSection section(*this);
+        const Road *road = findRoad(u, v);
+        if (road == nullptr) return -1; // Indicate not found
+        return unpack(road->counts.load(memory_order_relaxed), isEmergency);
+    }
+
+    /**
+     * Increments the regular or emergency count of a road by one. Lock-free; any number of threads may count
+     * trips on the same road at once.
+     *
+     * @param u The first endpoint of the road.
+     * @param v The second endpoint of the road.
+     * @param isEmergency True to increment the emergency count, false for the regular count.
+     */
+    void incrementCount(int u, int v, bool isEmergency) {
+        addCount(u, v, 1, isEmergency);
+    }
+
+    /**
+     * Adds a number of trips to the regular or emergency count of a road in one atomic update.
+     *
+     * @param u The first endpoint of the road.
+     * @param v The second endpoint of the road.
+     * @param amount The number of trips to add.
+     * @param isEmergency True to add to the emergency count, false for the regular count.
+     */
+    void addCount(int u, int v, int amount, bool isEmergency) {
+        ReadSection section(*this);
+        Road *road = findRoad(u, v);
+        if (road == nullptr) return;
+        const unsigned long long unit = isEmergency ? EMERGENCY_UNIT : REGULAR_UNIT;
+        road->counts.fetch_add(unit * static_cast<unsigned long long>(amount), memory_order_relaxed);
+    }
+
+    /**
+     * Decrements the regular or emergency count of a road by one, never going below zero. Lock-free: the
+     * update is retried if another thread changed the counts in between.
+     *
+     * @param u The first endpoint of the road.
+     * @param v The second endpoint of the road.
+     * @param isEmergency True to decrement the emergency count, false for the regular count.
+     */
+    void decrementCount(int u, int v, bool isEmergency) {
+        ReadSection section(*this);
+        Road *road = findRoad(u, v);
+        if (road == nullptr) return;
+        const unsigned long long unit = isEmergency ? EMERGENCY_UNIT : REGULAR_UNIT;
+        unsigned long long counts = road->counts.load(memory_order_relaxed);
+        while (unpack(counts, isEmergency) > 0 &&
+               !road->counts.compare_exchange_weak(counts, counts - unit, memory_order_relaxed)) {
+        }
+    }
+
+    /**
+     * Calculates the density of traffic on a road as the sum of its regular and emergency counts, both read
+     * in one atomic load.
+     *
+     * @param u The first endpoint of the road.
+     * @param v The second endpoint of the road.
+     * @return The density, or -1 if the road is not found.
+     */
+    float calculateDensity(int u, int v) const {
+        ReadSection section(*this);
+        const Road *road = findRoad(u, v);
+        if (road == nullptr) return -1; // Indicate not found
+        const unsigned long long counts = road->counts.load(memory_order_relaxed);
+        return unpack(counts, false) + unpack(counts, true);
+    }
+
+    /**
+     * Copies the counts of every road, in slot order, without stopping writers. Both counts of a road are read
+     * together, so each entry is a consistent pair; updates made while the copy is taken may or may not be
+     * included.
+     *
+     * @return One entry per live road.
+     */
+    Vector<RoadCounts> snapshot() const {
+        ReadSection section(*this);
+        const Index &current = *index.load();
+        Vector<RoadCounts> entries;
+        entries.reserve(occupied.load(memory_order_relaxed));
+        for (const atomic<Road *> &slot : current.slots) {
+            const Road *road = slot.load(memory_order_acquire);
+            if (road == nullptr || road == &removed) continue;
+            const unsigned long long counts = road->counts.load(memory_order_relaxed);
+            entries.push_back(RoadCounts{static_cast<int>(road->key >> 32), static_cast<int>(road->key & 0xffffffffLL),
+                                         unpack(counts, false), unpack(counts, true)});
+        }
+        return entries;
+    }
+
+    /**
+     * Displays every road in the table with its regular and emergency counts, using vertex indices.
+     */
+    void display() const {
+        for (const RoadCounts &entry : snapshot()) {
+            cout << "Road (" << entry.u << ", " << entry.v << ") - Regular Count: " << entry.regularCount
+                 << " - Emergency Count: " << entry.emergencyCount << endl;
+        }
+    }
+
+    /**
+     * Displays every road with its counts, printing intersection names instead of vertex indices.
+     *
+     * @param intersections The index used to turn vertex indices back into intersection names.
+     */
+    void display(const IntersectionIndex &intersections) const {
+        for (const RoadCounts &entry : snapshot()) {
+            cout << "Road (" << intersections.getName(entry.u) << ", " << intersections.getName(entry.v)
+                 << ") - Regular Count: " << entry.regularCount << " - Emergency Count: " << entry.emergencyCount
+                 << endl;
+        }
+    }
+
+    /**
+     * Computes the load factor of the table: the number of live roads divided by the number of slots.
+     *
+     * @return The load factor as a float.
+     */
+    float loadFactor() const {
+        ReadSection section(*this);
+        return static_cast<float>(occupied.load(memory_order_relaxed)) / index.load()->slots.getSize();
+    }
+
+    /**
+     * Returns the number of roads currently stored in the table.
+     * @return The number of live roads.
+     */
+    int getSize() const {
+        return occupied.load(memory_order_relaxed);
+    }
+};
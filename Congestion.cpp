@@ -0,0 +1,163 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+using namespace std;
+
+/**
+ * The number of origins a routing thread claims at a time. Each origin costs a whole shortest-path tree, so
+ * handing them out one by one keeps the threads evenly loaded.
+ */
+constexpr int ORIGIN_BATCH_SIZE = 1;
+
+/**
+ * Routes a batch of trips on every core and counts them on the roads they take.
+ *
+ * The trips are sorted by (start, end) first. Identical trips are routed once and counted with their
+ * multiplicity, and all trips leaving the same intersection share one shortest-path tree, so the number of
+ * searches is the number of distinct origins rather than the number of trips. Each route is the one
+ * dijkstraPath would return for the trip.
+ *
+ * The origins are spread over the threads. Every search only reads the snapshot and the closures and runs in
+ * its thread's own workspace, and the counts go straight into the shared table, whose counters are updated
+ * atomically without locks, so the totals are the same however the origins are split between threads.
+ *
+ * @param network The CSR snapshot of the graph to route on.
+ * @param starts The start vertex of every trip.
+ * @param ends The end vertex of every trip.
+ * @param count The number of trips.
+ * @param closures The compiled road closures to avoid.
+ * @param hashTable The table holding every road of the snapshot, incremented once for every trip that takes a road.
+ * @param isEmergency True to count the trips as emergency trips, false for regular trips.
+ */
+void countTrips(const CSRGraph &network, const int *starts, const int *ends, const int count,
+                const EdgeMap<int> &closures, ConcurrentHashTable &hashTable, const bool isEmergency) {
+    // Sort the trips so equal trips are adjacent and the trips from one origin form a run
+    Vector<unsigned long long> trips;
+    trips.reserve(count);
+    for (int i = 0; i < count; i++) {
+        trips.push_back(edgeKey(starts[i], ends[i]));
+    }
+    std::sort(trips.begin(), trips.end());
+
+    // Collapse the runs into distinct destinations with their multiplicity, grouped by origin like a CSR row:
+    // the destinations of origins[k] occupy [originOffsets[k], originOffsets[k + 1])
+    Vector<int> origins;
+    Vector<int> originOffsets;
+    Vector<int> destinations;
+    Vector<int> multiplicities;
+    for (int i = 0; i < count; i++) {
+        const int start = static_cast<int>(trips[i] >> 32);
+        if (i == 0 || trips[i] >> 32 != trips[i - 1] >> 32) {
+            origins.push_back(start);
+            originOffsets.push_back(destinations.getSize());
+        }
+        if (i > 0 && trips[i] == trips[i - 1]) {
+            multiplicities[multiplicities.getSize() - 1]++;
+        } else {
+            destinations.push_back(static_cast<int>(trips[i] & 0xffffffffULL));
+            multiplicities.push_back(1);
+        }
+    }
+    originOffsets.push_back(destinations.getSize());
+
+    parallelFor(origins.getSize(), ORIGIN_BATCH_SIZE, [&](const int first, const int last) {
+        SearchWorkspace &workspace = threadWorkspace();
+        for (int k = first; k < last; k++) {
+            const int begin = originOffsets[k];
+            const int destinationCount = originOffsets[k + 1] - begin;
+            shortestPathTree(network, origins[k], destinations.begin() + begin, destinationCount, closures, workspace);
+            for (int d = begin; d < originOffsets[k + 1]; d++) {
+                if (destinations[d] < 0 || destinations[d] >= network.getSize()) continue;
+                Route path = tracePath(workspace, origins[k], destinations[d]);
+                for (int j = 0; j + 1 < path.getSize(); j++) {
+                    hashTable.addCount(path[j], path[j + 1], multiplicities[d], isEmergency);
+                }
+            }
+        }
+    });
+}
+
+/**
+ * The number of emergency trips a routing thread claims at a time. A* searches are short, so a few trips per
+ * claim keep the shared counter out of the way.
+ */
+constexpr int EMERGENCY_BATCH_SIZE = 8;
+
+/**
+ * Routes emergency trips one by one with A* on every core and counts them as emergency trips on the roads they take.
+ *
+ * Emergency vehicles are dispatched individually, so each trip gets its own goal-directed search instead of
+ * sharing a shortest-path tree with others from the same origin.
+ *
+ * @param network The CSR snapshot of the graph to route on.
+ * @param starts The start vertex of every trip.
+ * @param ends The end vertex of every trip.
+ * @param count The number of trips.
+ * @param closures The compiled road closures to avoid.
+ * @param heuristic The lower bounds that guide each search, built for the same snapshot.
+ * @param hashTable The table holding every road of the snapshot, incremented once for every trip that takes a road.
+ */
+template<typename Heuristic>
+void countEmergencyTrips(const CSRGraph &network, const int *starts, const int *ends, const int count,
+                         const EdgeMap<int> &closures, const Heuristic &heuristic, ConcurrentHashTable &hashTable) {
+    parallelFor(count, EMERGENCY_BATCH_SIZE, [&](const int first, const int last) {
+        SearchWorkspace &workspace = threadWorkspace();
+        for (int i = first; i < last; i++) {
+            Route path = astarPath(network, starts[i], ends[i], closures, heuristic, workspace);
+            for (int j = 0; j + 1 < path.getSize(); j++) {
+                hashTable.incrementCount(path[j], path[j + 1], true);
+            }
+        }
+    });
+}
+
+/**
+ * Populates the hash table with congestion data derived from the graph, taking into account road closures and vehicle paths.
+ *
+ * @param graph The graph representing the network of roads between various nodes.
+ * @param vehicles The vehicles, whose start and end columns are routed.
+ * @param emergencyVehicles The emergency vehicles, whose start and end columns are routed.
+ * @param roadClosures The road closures, each with two intersections and a closure status.
+ * @param trafficSignals The traffic signals (currently unused in the function).
+ * @param hashTable The hash table used to store and display congestion data including regular and emergency vehicle counts.
+ * @param intersections The index used to print intersection names when displaying the hash table.
+ */
+void populateCongestionHashTable(Graph &graph, const VehicleTable &vehicles, const EmergencyVehicleTable &emergencyVehicles, const ClosureTable &roadClosures, const SignalTable &trafficSignals, ConcurrentHashTable &hashTable, const IntersectionIndex &intersections) {
+
+    // Step 2: Apply road closures
+    for (int i = 0; i < roadClosures.getSize(); i++) {
+        int u = roadClosures.getIntersection1(i);
+        int v = roadClosures.getIntersection2(i);
+        int status = roadClosures.getStatus(i);
+        if (status == ROAD_UNDER_REPAIR || status == ROAD_BLOCKED) {
+            //cout << "Deletions." << endl;
+            graph.deleteEdge(u, v);
+            graph.deleteEdge(v, u);
+        }
+    }
+
+    // Compile the closures once so every route below checks them in O(1)
+    EdgeMap<int> closures = compileRoadClosures(roadClosures);
+
+    // Step 3: Insert all remaining roads into the hash table
+    const CSRGraph &network = graph.getSnapshot();
+    for (int u = 0; u < network.getSize(); u++) {
+        for (int e = network.edgeBegin(u); e < network.edgeEnd(u); e++) {
+            hashTable.insert(u, network.getTarget(e));
+        }
+    }
+
+    // Step 4: For each vehicle, find the shortest path on every core and count it on the roads it takes
+    countTrips(network, vehicles.getStarts(), vehicles.getEnds(), vehicles.getSize(), closures, hashTable, false);
+
+    // Step 5: Route each emergency vehicle with A*, guided by landmark lower bounds
+    if (emergencyVehicles.getSize() > 0) {
+        const LandmarkHeuristic landmarks(network);
+        countEmergencyTrips(network, emergencyVehicles.getStarts(), emergencyVehicles.getEnds(),
+                            emergencyVehicles.getSize(), closures, landmarks, hashTable);
+    }
+
+    // Step 6: Display the hash table
+    hashTable.display(intersections);
+}
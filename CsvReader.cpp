@@ -0,0 +1,268 @@
+#include <iostream>
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <string_view>
+#include <charconv>
+#include <cstring>
+
+using namespace std;
+
+/**
+ * Parses a whole field as a decimal integer.
+ *
+ * @param field The field text, without surrounding spaces.
+ * @param value Set to the parsed number on success.
+ * @return True if the field is a valid integer in the range of int, false otherwise (including trailing characters).
+ */
+bool parseInt(const string_view field, int &value) {
+    const char *last = field.data() + field.size();
+    const from_chars_result result = from_chars(field.data(), last, value);
+    return result.ec == errc() && result.ptr == last;
+}
+
+/**
+ * Parses a whole field as a decimal floating-point number.
+ *
+ * @param field The field text, without surrounding spaces.
+ * @param value Set to the parsed number on success.
+ * @return True if the field is a valid number, false otherwise (including trailing characters).
+ */
+bool parseFloat(const string_view field, float &value) {
+    const char *last = field.data() + field.size();
+    const from_chars_result result = from_chars(field.data(), last, value);
+    return result.ec == errc() && result.ptr == last;
+}
+
+/**
+ * A fast reader for the comma-separated dataset files.
+ *
+ * The file is memory-mapped and every row is split in place: fields are string_views into the mapping, so
+ * reading a row allocates nothing and copies nothing. Numbers are then parsed with parseInt and parseFloat
+ * instead of stoi/stof, and rows that do not parse can be reported with their line number and skipped.
+ * Fields are separated by commas and may not be quoted. The views stay valid until the reader is closed.
+ *
+ * A reader can also walk a range of a file that is mapped elsewhere, which lets several threads each parse
+ * one chunk of the same file.
+ */
+class CsvReader {
+    /**
+     * The mapped file. Unused when the reader walks a range mapped elsewhere.
+     */
+    MappedFile file;
+    /**
+     * The name of the file, used in error messages.
+     */
+    string fileName;
+    /**
+     * The start of the next unread line.
+     */
+    const char *cursor;
+    /**
+     * One past the last byte of the file.
+     */
+    const char *end;
+    /**
+     * The current line, without its line feed.
+     */
+    string_view line;
+    /**
+     * The 1-based number of the current line, counting the header (or, for a range, counting from its first line).
+     */
+    int lineNumber;
+    /**
+     * The fields of the current row, with surrounding spaces and carriage returns removed.
+     */
+    SmallVector<string_view, 8> fields;
+
+    /**
+     * Moves to the next line of the file.
+     *
+     * @return True if there was another line, false at the end of the file.
+     */
+    bool advanceLine() {
+        if (cursor == end) return false;
+        const char *newline = static_cast<const char *>(memchr(cursor, '\n', end - cursor));
+        const char *lineEnd = newline ? newline : end;
+        line = string_view(cursor, lineEnd - cursor);
+        cursor = newline ? newline + 1 : end;
+        lineNumber++;
+        return true;
+    }
+
+    /**
+     * Strips surrounding spaces and a trailing carriage return (from files saved with Windows line endings) from a field.
+     *
+     * @param first The first character of the field.
+     * @param last One past the last character of the field.
+     * @return The trimmed field.
+     */
+    static string_view trim(const char *first, const char *last) {
+        while (first < last && *first == ' ') first++;
+        while (last > first && (last[-1] == ' ' || last[-1] == '\r')) last--;
+        return string_view(first, last - first);
+    }
+
+    /**
+     * Splits the current line into fields.
+     */
+    void splitLine() {
+        fields.clear();
+        const char *first = line.data();
+        const char *last = first + line.size();
+        while (true) {
+            const char *comma = static_cast<const char *>(memchr(first, ',', last - first));
+            if (!comma) {
+                fields.push_back(trim(first, last));
+                return;
+            }
+            fields.push_back(trim(first, comma));
+            first = comma + 1;
+        }
+    }
+
+public:
+    /**
+     * Constructs a reader with no file open.
+     */
+    CsvReader() : cursor(nullptr), end(nullptr), lineNumber(0) {}
+
+    /**
+     * Constructs a reader over a range of lines in memory owned by someone else, e.g. one chunk of a file opened by
+     * another reader. The range must start at the beginning of a line and stay valid while the reader is used.
+     *
+     * @param first The first byte of the range.
+     * @param last One past the last byte of the range.
+     * @param name The name of the file the range belongs to, used in error messages.
+     */
+    CsvReader(const char *first, const char *last, const string &name)
+        : fileName(name), cursor(first), end(last), lineNumber(0) {}
+
+    /**
+     * Opens a file for reading, starting at its first line.
+     *
+     * @param name The path of the file.
+     * @return True if the file was opened, false if it does not exist or cannot be read.
+     */
+    bool open(const string &name) {
+        if (!file.open(name)) return false;
+        fileName = name;
+        cursor = file.getData();
+        end = cursor + file.getSize();
+        lineNumber = 0;
+        fields.clear();
+        return true;
+    }
+
+    /**
+     * Skips one line without splitting it, e.g. the header.
+     *
+     * @return True if a line was skipped, false at the end of the file.
+     */
+    bool skipLine() {
+        return advanceLine();
+    }
+
+    /**
+     * Reads the next row and splits it into fields. Rows whose fields are all empty (blank lines, or lines such as
+     * ",," that some exports append) are skipped.
+     *
+     * @return True if a row was read, false at the end of the file.
+     */
+    bool nextRow() {
+        while (advanceLine()) {
+            splitLine();
+            for (const string_view field : fields) {
+                if (!field.empty()) return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Counts the lines that have not been read yet, e.g. to reserve room for the rows before loading them.
+     * Costs one fast scan over the rest of the file.
+     *
+     * @return The number of remaining lines, counting a final line without a line feed.
+     */
+    int countRemainingLines() const {
+        int count = 0;
+        const char *p = cursor;
+        while (p != end) {
+            const char *newline = static_cast<const char *>(memchr(p, '\n', end - p));
+            count++;
+            p = newline ? newline + 1 : end;
+        }
+        return count;
+    }
+
+    /**
+     * Returns the start of the next unread line, e.g. to split the rest of the file into chunks.
+     * @return A pointer to the next unread byte.
+     */
+    const char *getPosition() const {
+        return cursor;
+    }
+
+    /**
+     * Returns the end of the file or range being read.
+     * @return A pointer one past the last byte.
+     */
+    const char *getEnd() const {
+        return end;
+    }
+
+    /**
+     * Returns the number of fields in the current row.
+     * @return The number of fields.
+     */
+    int getFieldCount() const {
+        return fields.getSize();
+    }
+
+    /**
+     * Returns a field of the current row.
+     *
+     * @param index The index of the field. Must be in the range [0, getFieldCount()).
+     * @return The field, without surrounding spaces.
+     */
+    string_view getField(const int index) const {
+        return fields[index];
+    }
+
+    /**
+     * Returns the current line as it appears in the file, without its line feed.
+     * @return The raw line.
+     */
+    string_view getLine() const {
+        return line;
+    }
+
+    /**
+     * Returns the number of the current line.
+     * @return The 1-based line number, counting the header.
+     */
+    int getLineNumber() const {
+        return lineNumber;
+    }
+
+    /**
+     * Prints an error message naming the file and line of the current row, which the caller then skips.
+     *
+     * @param reason What is wrong with the row.
+     */
+    void reportMalformed(const char *reason) const {
+        printMalformed(fileName, lineNumber, reason);
+    }
+
+    /**
+     * Prints the error message for a malformed row, for rows that were parsed earlier and are reported later.
+     *
+     * @param name The name of the file.
+     * @param line The 1-based line number of the row.
+     * @param reason What is wrong with the row.
+     */
+    static void printMalformed(const string &name, const int line, const char *reason) {
+        cout << "Error: " << name << " line " << line << ": " << reason << "." << endl;
+    }
+};
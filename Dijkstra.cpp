@@ -3,15 +3,9 @@
 #include <sstream>
 #include <cmath>
 #include <ctime>
+#include <climits>
 using namespace std;
 
-/**
- * Represents an infinite distance used in the Dijkstra algorithm.
- * Initialized to the maximum possible integer value defined by INT_MAX.
- * Used as the initial distance for vertices to signify they are unvisited or unreachable.
- */
-constexpr float INF = INT_MAX;
-
 // Dijkstra's algorithm to find the shortest path
 // Vector<int> dijkstraPath(const Graph &graph, const int start, const int end) {
 //     auto *distance = new float[graph.getSize()];
@@ -74,169 +68,202 @@ constexpr float INF = INT_MAX;
 // }
 
 /**
- * Determines if there is a blocked edge between two nodes.
+ * Compiles the road closures produced by loadRoadClosures into an edge map that can be queried in O(1).
  *
- * @param blockedEdges A vector of vectors containing pairs of integers representing blocked edges.
- * @param u The first node to check for a blocked edge.
- * @param v The second node to check for a blocked edge.
- * @return True if an edge between node u and node v is blocked, false otherwise.
+ * Roads that are under repair or blocked are stored in both directions with their status code. Roads marked
+ * clear are not stored, and a later row for the same road overrides an earlier one, so a road that is listed
+ * as blocked and then as clear ends up open.
+ *
+ * @param roadClosures The closures, each holding two intersections and a status code.
+ * @return An edge map containing every impassable road, keyed by both of its directions.
  */
-bool isBlockedEdge(const Vector<Vector<int>> &blockedEdges, int u, int v) {
-    for (int i = 0; i < blockedEdges.getSize(); i++) {
-        // Access each closure using the index i
-        Vector<int> closure = blockedEdges[i];
-        if ((closure[0] == u && closure[1] == v) || (closure[0] == v && closure[1] == u)) {
-            return true;  // The road is blocked
+EdgeMap<int> compileRoadClosures(const ClosureTable &roadClosures) {
+    EdgeMap<int> closures;
+    for (int i = 0; i < roadClosures.getSize(); i++) {
+        int u = roadClosures.getIntersection1(i);
+        int v = roadClosures.getIntersection2(i);
+        int status = roadClosures.getStatus(i);
+        if (status == ROAD_UNDER_REPAIR || status == ROAD_BLOCKED) {
+            closures.insert(u, v, status);
+            closures.insert(v, u, status);
+        } else {
+            closures.erase(u, v);
+            closures.erase(v, u);
         }
     }
-    return false;   // The road is not blocked
+    return closures;
 }
 
 /**
- * Computes the shortest path in a graph from a start node to an end node while avoiding specified blocked edges.
+ * Determines if the road between two nodes is closed.
  *
- * @param graph The graph to search, represented as an adjacency list.
- * @param start The starting node of the path search.
- * @param end The destination node of the path search.
- * @param blockedEdges A vector of pairs representing edges that should be avoided in the path.
- * @return A vector of integers representing the shortest path from start to end node, avoiding blocked edges.
- *         If no path is found, an empty vector is returned.
+ * @param closures The compiled road closures returned by compileRoadClosures.
+ * @param u The first node to check for a blocked edge.
+ * @param v The second node to check for a blocked edge.
+ * @return True if the road between node u and node v is under repair or blocked, false otherwise.
  */
-Vector<int> dijkstraPath(const Graph &graph, const int start, const int end, const Vector<Vector<int>> &blockedEdges) {
-    auto *distance = new float[graph.getSize()];
-    auto visited = new bool[graph.getSize()];
-    auto *parent = new int[graph.getSize()];
-
-    for (int i = 0; i < graph.getSize(); i++) {
-        distance[i] = INF;
-        visited[i] = false;
-        parent[i] = -1;
-    }
-
-    distance[start] = 0;
-
-    for (int count = 0; count < graph.getSize(); count++) {
-        int u = -1;
-        float minDistance = INF;
-        for (int i = 0; i < graph.getSize(); i++) {
-            if (!visited[i] && distance[i] < minDistance) {
-                minDistance = distance[i];
-                u = i;
-            }
-        }
-
-        if (u == -1) break;
-        if (u == end) break;
-
-        visited[u] = true;
-
-        Node *neighbor = graph.getAdjacencyList(u).getHead();
-        while (neighbor != nullptr) {
-            int v = neighbor->data;
-            float weight = neighbor->weight;
-
-            // Skip the edge if it's blocked
-            if (isBlockedEdge(blockedEdges, u, v)) {
-                neighbor = neighbor->next;
-                continue;  // Skip blocked edge
-            }
-
-            if (!visited[v] && distance[u] + weight < distance[v]) {
-                distance[v] = distance[u] + weight;
-                parent[v] = u;
-            }
+inline bool isBlockedEdge(const EdgeMap<int> &closures, const int u, const int v) {
+    return !closures.isEmpty() && closures.contains(u, v);
+}
 
-            neighbor = neighbor->next;
-        }
-    }
+/**
+ * A route returned by dijkstraPath: the vertices from start to end. Routes of up to 32 vertices are held inline,
+ * so routing a vehicle through a city-sized network normally does not touch the heap at all.
+ */
+typedef SmallVector<int, 32> Route;
 
-    Vector<int> path;
+/**
+ * Reads the path to a vertex out of the parent links left in a workspace by the last search.
+ *
+ * @param workspace The workspace the search ran in.
+ * @param start The source of the search.
+ * @param end The vertex to read the path to. Must be a vertex of the graph, and its parent and the parents along
+ *            its path must be final.
+ * @return The vertices from start to end, or an empty route if end was not reached.
+ */
+Route tracePath(const SearchWorkspace &workspace, const int start, const int end) {
+    Route path;
     int current = end;
     while (current != -1) {
         path.push_back(current);
-        current = parent[current];
+        current = workspace.getParent(current);
     }
     path.reverse();
 
-    delete[] distance;
-    delete[] visited;
-    delete[] parent;
-
     if (path.isEmpty() || path[0] != start || path[path.getSize() - 1] != end) {
-        return Vector<int>();  // No path found
+        return Route();  // No path found
     }
 
     return path;
 }
 
-
 /**
- * Populates the hash table with congestion data derived from the graph, taking into account road closures and vehicle paths.
+ * Grows a shortest-path tree from one source until it covers every given destination, avoiding the compiled
+ * road closures. Afterwards tracePath reads the route to any of the destinations out of the workspace.
+ *
+ * Vertices are settled in the same order as by dijkstraPath, so the route to each destination is exactly the
+ * one dijkstraPath would return for it; the search just keeps going until the farthest destination is
+ * settled instead of stopping at the first.
  *
- * @param graph The graph representing the network of roads between various nodes.
- * @param vehicles A 2D vector where each sub-vector contains vehicle data including start and end nodes.
- * @param emergencyVehicles A 2D vector where each sub-vector contains emergency vehicle data including start and end nodes.
- * @param roadClosures A 2D vector where each sub-vector represents a road closure with starting and ending nodes and closure status.
- * @param trafficSignals A 2D vector representing traffic signal data (currently unused in the function).
- * @param hashTable The hash table used to store and display congestion data including regular and emergency vehicle counts.
+ * @param network The CSR snapshot of the graph to search.
+ * @param start The source of the search.
+ * @param targets The destinations. Duplicates and vertices outside the graph are allowed.
+ * @param targetCount The number of destinations.
+ * @param closures The compiled road closures to avoid, as returned by compileRoadClosures.
+ * @param workspace The scratch state to run the search in.
  */
-void populateCongestionHashTable(Graph &graph, Vector<Vector<int>> &vehicles, Vector<Vector<int>> &emergencyVehicles, Vector<Vector<int>> &roadClosures, Vector<Vector<int>> &trafficSignals, HashTable &hashTable) {
+void shortestPathTree(const CSRGraph &network, const int start, const int *targets, const int targetCount,
+                      const EdgeMap<int> &closures, SearchWorkspace &workspace) {
+    workspace.begin(network.getSize());
+    if (start < 0 || start >= network.getSize()) return;
 
-    // Step 2: Apply road closures
-    for (int i = 0; i < roadClosures.getSize(); i++) {
-        Vector<int> closureData = roadClosures[i];
-        int u = closureData[0];
-        int v = closureData[1];
-        int status = closureData[2];
-        if (status == 1 || status == 2) { // Under Repair or Blocked
-            //cout << "Deletions." << endl;
-            graph.deleteEdge(u, v);
-            graph.deleteEdge(v, u);
+    int remaining = 0;
+    for (int i = 0; i < targetCount; i++) {
+        if (targets[i] >= 0 && targets[i] < network.getSize() && workspace.markTarget(targets[i])) {
+            remaining++;
         }
     }
+    if (remaining == 0) return;
+    workspace.relax(start, 0, -1);
+
+    FrontierHeap &frontier = workspace.getFrontier();
+    while (!frontier.isEmpty()) {
+        int u = frontier.extractMin();
+        workspace.settle(u);
+        if (workspace.isTarget(u) && --remaining == 0) break;
 
-    // Step 3: Insert all remaining roads into the hash table
-    for (int u = 0; u < graph.getSize(); u++) {
-        Node *neighbor = graph.getAdjacencyList(u).getHead();
-        while (neighbor != nullptr) {
-            int v = neighbor->data;
-            hashTable.insert(u, v);
-            neighbor = neighbor->next;
+        float distanceU = workspace.getDistance(u);
+        for (int e = network.edgeBegin(u); e < network.edgeEnd(u); e++) {
+            int v = network.getTarget(e);
+            float weight = network.getWeight(e);
+
+            // Skip the edge if it's blocked
+            if (isBlockedEdge(closures, u, v)) {
+                continue;
+            }
+
+            if (!workspace.isSettled(v) && distanceU + weight < workspace.getDistance(v)) {
+                workspace.relax(v, distanceU + weight, u);
+            }
         }
     }
+}
 
-    // Step 4: For each vehicle, find the shortest path and increment regularCount
-    for (int i = 0; i < vehicles.getSize(); i++) {
-        Vector<int> vehicleData = vehicles[i];
-        int start = vehicleData[1];
-        int end = vehicleData[2];
-        Vector<int> path = dijkstraPath(graph, start, end, roadClosures);
-        // for (int v = 0; v<path.getSize(); v++) {
-        //     cout << path[v] << "  ";
-        // }
-        // cout << endl;
-        if (path.getSize() < 2) continue;
-        for (int j = 0; j < path.getSize() - 1; j++) {
-            int u = path[j];
-            int v = path[j+1];
-            hashTable.incrementCount(u, v, false);
-        }
+/**
+ * Computes the shortest path in a graph from a start node to an end node while avoiding specified blocked edges.
+ *
+ * The next vertex to settle is taken from an indexed binary heap with decrease-key rather than by scanning
+ * every vertex, so a query costs O((V + E) log V) instead of O(V^2). All scratch state lives in the given workspace, so repeated
+ * queries allocate nothing (short of a route longer than Route's inline capacity) and only pay for the vertices they actually reach.
+ *
+ * @param network The CSR snapshot of the graph to search.
+ * @param start The starting node of the path search.
+ * @param end The destination node of the path search.
+ * @param closures The compiled road closures to avoid, as returned by compileRoadClosures.
+ * @param workspace The scratch state to run the search in.
+ * @return A vector of integers representing the shortest path from start to end node, avoiding blocked edges.
+ *         If no path is found, an empty vector is returned.
+ */
+Route dijkstraPath(const CSRGraph &network, const int start, const int end, const EdgeMap<int> &closures, SearchWorkspace &workspace) {
+    if (start < 0 || end < 0 || start >= network.getSize() || end >= network.getSize()) {
+        return Route();
     }
 
-    // Step 5: For each emergency vehicle, find the shortest path and increment emergencyCount
-    for (int i = 0; i < emergencyVehicles.getSize(); i++) {
-        Vector<int> emVehicleData = emergencyVehicles[i];
-        int start = emVehicleData[1];
-        int end = emVehicleData[2];
-        Vector<int> path = dijkstraPath(graph, start, end, roadClosures);
-        if (path.getSize() < 2) continue;
-        for (int j = 0; j < path.getSize() - 1; j++) {
-            int u = path[j];
-            int v = path[j+1];
-            hashTable.incrementCount(u, v, true);
+    workspace.begin(network.getSize());
+    workspace.relax(start, 0, -1);
+
+    FrontierHeap &frontier = workspace.getFrontier();
+    while (!frontier.isEmpty()) {
+        int u = frontier.extractMin();
+        if (u == end) break;
+
+        workspace.settle(u);
+        float distanceU = workspace.getDistance(u);
+
+        for (int e = network.edgeBegin(u); e < network.edgeEnd(u); e++) {
+            int v = network.getTarget(e);
+            float weight = network.getWeight(e);
+
+            // Skip the edge if it's blocked
+            if (isBlockedEdge(closures, u, v)) {
+                continue;
+            }
+
+            if (!workspace.isSettled(v) && distanceU + weight < workspace.getDistance(v)) {
+                workspace.relax(v, distanceU + weight, u);
+            }
         }
     }
 
-    // Step 6: Display the hash table
-    hashTable.display();
+    return tracePath(workspace, start, end);
+}
+
+/**
+ * Computes the shortest path from start to end while avoiding the compiled road closures,
+ * using the graph's CSR snapshot and the calling thread's reusable workspace.
+ *
+ * @param graph The graph to search, represented as an adjacency list.
+ * @param start The starting node of the path search.
+ * @param end The destination node of the path search.
+ * @param closures The compiled road closures to avoid, as returned by compileRoadClosures.
+ * @return The shortest path from start to end, or an empty vector if no path is found.
+ */
+Route dijkstraPath(const Graph &graph, const int start, const int end, const EdgeMap<int> &closures) {
+    return dijkstraPath(graph.getSnapshot(), start, end, closures, threadWorkspace());
+}
+
+/**
+ * Computes the shortest path from start to end while avoiding the given road closures.
+ *
+ * Convenience overload that compiles the closures on every call. Callers routing many vehicles should
+ * compile them once with compileRoadClosures and use the EdgeMap overload instead.
+ *
+ * @param graph The graph to search, represented as an adjacency list.
+ * @param start The starting node of the path search.
+ * @param end The destination node of the path search.
+ * @param blockedEdges The closures, each holding two intersections and a status code.
+ * @return The shortest path from start to end, or an empty vector if no path is found.
+ */
+Route dijkstraPath(const Graph &graph, const int start, const int end, const ClosureTable &blockedEdges) {
+    return dijkstraPath(graph, start, end, compileRoadClosures(blockedEdges));
 }
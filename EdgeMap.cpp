@@ -0,0 +1,234 @@
+#include <iostream>
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <utility>
+using namespace std;
+
+/**
+ * Packs a directed edge (u, v) into a single 64-bit key.
+ * The source occupies the high 32 bits and the target the low 32 bits, so distinct edges never collide.
+ *
+ * @param u The source vertex of the edge.
+ * @param v The target vertex of the edge.
+ * @return The 64-bit key identifying the edge.
+ */
+inline unsigned long long edgeKey(const int u, const int v) {
+    return (static_cast<unsigned long long>(static_cast<unsigned int>(u)) << 32) | static_cast<unsigned int>(v);
+}
+
+/**
+ * Scrambles a 64-bit key so that every input bit affects every output bit (the splitmix64 finalizer).
+ * Edge keys from neighbouring vertices differ only in a few low bits, so they must be mixed before
+ * being reduced to a table index.
+ *
+ * @param key The key to mix.
+ * @return The mixed hash value.
+ */
+inline unsigned long long mixKey(unsigned long long key) {
+    key ^= key >> 30;
+    key *= 0xbf58476d1ce4e5b9ULL;
+    key ^= key >> 27;
+    key *= 0x94d049bb133111ebULL;
+    key ^= key >> 31;
+    return key;
+}
+
+template<typename V>
+/**
+ * An open-addressing hash map from directed edges (u, v) to values of type V.
+ *
+ * Uses linear probing over a power-of-two table and grows automatically, so lookups are O(1) on average
+ * and never allocate. Erasing shifts later entries of the probe run backwards, so no tombstones are left behind.
+ */
+class EdgeMap {
+    /**
+     * Marks a slot that holds no edge. No real edge maps to it because vertex indices are never negative.
+     */
+    static constexpr unsigned long long EMPTY_SLOT = ~0ULL;
+
+    /**
+     * The edge key stored in each slot, or EMPTY_SLOT.
+     */
+    Vector<unsigned long long> keys;
+    /**
+     * The value stored alongside the key in the slot with the same index.
+     */
+    Vector<V> values;
+    /**
+     * The number of edges currently stored.
+     */
+    int count;
+    /**
+     * The table capacity minus one, used to reduce hashes to slot indices.
+     */
+    int mask;
+
+    /**
+     * Rebuilds the table with the given number of slots and reinserts every stored edge.
+     *
+     * @param newCapacity The new number of slots. Must be a power of two larger than the current count.
+     */
+    void rehash(const int newCapacity) {
+        Vector<unsigned long long> oldKeys = std::move(keys);
+        Vector<V> oldValues = std::move(values);
+
+        keys = Vector<unsigned long long>(newCapacity, EMPTY_SLOT);
+        values = Vector<V>(newCapacity);
+        mask = newCapacity - 1;
+
+        for (int i = 0; i < oldKeys.getSize(); i++) {
+            if (oldKeys[i] != EMPTY_SLOT) {
+                int slot = static_cast<int>(mixKey(oldKeys[i]) & mask);
+                while (keys[slot] != EMPTY_SLOT) {
+                    slot = (slot + 1) & mask;
+                }
+                keys[slot] = oldKeys[i];
+                values[slot] = std::move(oldValues[i]);
+            }
+        }
+    }
+
+    /**
+     * Finds the slot holding the given key.
+     *
+     * @param key The edge key to look for.
+     * @return The slot index, or -1 if the key is not stored.
+     */
+    int findSlot(const unsigned long long key) const {
+        if (count == 0) return -1;
+        int slot = static_cast<int>(mixKey(key) & mask);
+        while (keys[slot] != EMPTY_SLOT) {
+            if (keys[slot] == key) return slot;
+            slot = (slot + 1) & mask;
+        }
+        return -1;
+    }
+
+public:
+    /**
+     * Constructs an empty EdgeMap with a small initial table.
+     */
+    EdgeMap() : keys(16, EMPTY_SLOT), values(16), count(0), mask(15) {}
+
+    /**
+     * Inserts the edge (u, v) with the given value, or overwrites the value if the edge is already stored.
+     *
+     * @param u The source vertex of the edge.
+     * @param v The target vertex of the edge.
+     * @param value The value to associate with the edge.
+     */
+    void insert(const int u, const int v, const V &value) {
+        // Keep the load factor below 0.7 so probe runs stay short
+        if ((count + 1) * 10 > keys.getSize() * 7) {
+            rehash(keys.getSize() * 2);
+        }
+
+        const unsigned long long key = edgeKey(u, v);
+        int slot = static_cast<int>(mixKey(key) & mask);
+        while (keys[slot] != EMPTY_SLOT) {
+            if (keys[slot] == key) {
+                values[slot] = value;
+                return;
+            }
+            slot = (slot + 1) & mask;
+        }
+        keys[slot] = key;
+        values[slot] = value;
+        count++;
+    }
+
+    /**
+     * Looks up the value stored for the edge (u, v).
+     *
+     * @param u The source vertex of the edge.
+     * @param v The target vertex of the edge.
+     * @return A pointer to the stored value, or nullptr if the edge is not stored.
+     */
+    V *find(const int u, const int v) {
+        const int slot = findSlot(edgeKey(u, v));
+        return slot == -1 ? nullptr : &values[slot];
+    }
+
+    /**
+     * Looks up the value stored for the edge (u, v).
+     *
+     * @param u The source vertex of the edge.
+     * @param v The target vertex of the edge.
+     * @return A const pointer to the stored value, or nullptr if the edge is not stored.
+     */
+    const V *find(const int u, const int v) const {
+        const int slot = findSlot(edgeKey(u, v));
+        return slot == -1 ? nullptr : &values[slot];
+    }
+
+    /**
+     * Checks whether the edge (u, v) is stored.
+     *
+     * @param u The source vertex of the edge.
+     * @param v The target vertex of the edge.
+     * @return True if the edge is stored, false otherwise.
+     */
+    bool contains(const int u, const int v) const {
+        return findSlot(edgeKey(u, v)) != -1;
+    }
+
+    /**
+     * Removes the edge (u, v) if it is stored.
+     * Entries later in the same probe run are shifted back so that lookups never need tombstones.
+     *
+     * @param u The source vertex of the edge.
+     * @param v The target vertex of the edge.
+     * @return True if the edge was removed, false if it was not stored.
+     */
+    bool erase(const int u, const int v) {
+        int hole = findSlot(edgeKey(u, v));
+        if (hole == -1) return false;
+
+        int slot = hole;
+        while (true) {
+            slot = (slot + 1) & mask;
+            if (keys[slot] == EMPTY_SLOT) break;
+
+            // An entry may fill the hole only if its home slot does not lie between the hole and its current slot
+            const int home = static_cast<int>(mixKey(keys[slot]) & mask);
+            if (((slot - home) & mask) >= ((slot - hole) & mask)) {
+                keys[hole] = keys[slot];
+                values[hole] = values[slot];
+                hole = slot;
+            }
+        }
+
+        keys[hole] = EMPTY_SLOT;
+        values[hole] = V();
+        count--;
+        return true;
+    }
+
+    /**
+     * Removes every edge while keeping the current table capacity.
+     */
+    void clear() {
+        for (int i = 0; i < keys.getSize(); i++) {
+            keys[i] = EMPTY_SLOT;
+            values[i] = V();
+        }
+        count = 0;
+    }
+
+    /**
+     * Returns the number of edges stored in the map.
+     * @return The number of stored edges.
+     */
+    int getSize() const {
+        return count;
+    }
+
+    /**
+     * Checks whether the map stores no edges.
+     * @return True if the map is empty, false otherwise.
+     */
+    bool isEmpty() const {
+        return count == 0;
+    }
+};
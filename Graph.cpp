@@ -8,17 +8,296 @@ using namespace std;
  * Represents a graph using adjacency lists.
  */
 class Graph {
+    /**
+     * The slab pool every adjacency list allocates its nodes from. Edges added one after another end up next to
+     * each other in memory, and destroying or reassigning the graph frees all nodes at once instead of one by one.
+     * Declared before adjacencyList so that it is constructed first and destroyed last.
+     */
+    NodePool<Node> nodePool;
     /**
      * Represents the adjacency list of a graph, where each index in the vector corresponds
      * to a vertex in the graph, and the linked list at each index stores the adjacent vertices.
      * Used to efficiently store and retrieve the graph's edges for operations like traversals and searches.
      */
     Vector<LinkedList> adjacencyList;
+    /**
+     * The reverse adjacency list: the list of vertex v holds one node per edge (u, v), with u as its data.
+     * Lets deleteNode find the edges leading into a vertex without scanning every other list.
+     * Only the source is recorded; edge weights live in adjacencyList (and in the snapshot's reverse CSR).
+     */
+    Vector<LinkedList> incomingList;
     /**
      * The number of vertices in the graph.
      * This variable indicates the total number of nodes present in the graph.
      */
     int numVertices;
+    /**
+     * Counts modifications to the adjacency lists. Every mutating method increments it,
+     * which tells the cached snapshot when it has to be rebuilt.
+     */
+    unsigned long long version;
+    /**
+     * The cached CSR snapshot used by read-only algorithms. Rebuilt lazily by getSnapshot.
+     */
+    mutable CSRGraph snapshot;
+    /**
+     * The version the cached snapshot was built from, or ~0 if it has never been built.
+     */
+    mutable unsigned long long snapshotVersion;
+
+    /**
+     * The number of edge changes the journal remembers. Older changes are dropped as new ones arrive.
+     */
+    static constexpr int JOURNAL_CAPACITY = 4096;
+
+    /**
+     * An edge that was removed or made slower, and the version the change produced.
+     */
+    struct EdgeChange {
+        unsigned long long version;
+        int u;
+        int v;
+    };
+
+    /**
+     * The most recent edges that were removed or made slower, as a ring buffer in version order.
+     * Such changes can only lengthen the routes that use the edge, so route caches replay them to drop exactly
+     * those routes (see forEachSlowedEdgeSince).
+     */
+    Vector<EdgeChange> journal;
+    /**
+     * The slot of the journal the next change is written to.
+     */
+    int journalNext;
+    /**
+     * The version of the newest change that was dropped from the journal, or 0 if none was.
+     */
+    unsigned long long journalDropped;
+    /**
+     * The version of the last change that may have made some route shorter (an added edge, a lower weight or a
+     * wholesale replacement of the graph). No journal can tell which routes such a change affects.
+     */
+    unsigned long long lastShortening;
+
+    /**
+     * Vertices with more outgoing edges than this are hubs: their edges are indexed in edgeIndex so that
+     * looking up, reweighting or deleting one of them does not scan the whole adjacency list.
+     * Shorter lists are scanned directly, which is faster than a hash lookup at that size.
+     */
+    static constexpr int HUB_DEGREE = 16;
+
+    /**
+     * The indexed node of an edge (u, v) leaving a hub vertex.
+     */
+    struct EdgeRef {
+        /**
+         * The first node in u's adjacency list holding v.
+         */
+        Node *node;
+        /**
+         * The node before it in u's adjacency list, or nullptr if it is the head. Kept so the edge can be
+         * unlinked from the singly linked list in O(1).
+         */
+        Node *previous;
+        /**
+         * How many nodes in u's adjacency list hold v, counting parallel roads.
+         */
+        int multiplicity;
+    };
+
+    /**
+     * Maps each edge (u, v) leaving a hub vertex u to its node in u's adjacency list.
+     */
+    EdgeMap<EdgeRef> edgeIndex;
+    /**
+     * Marks the vertices whose outgoing edges are kept in edgeIndex. A vertex stays a hub until it is deleted,
+     * even if its list shrinks below HUB_DEGREE again.
+     */
+    Vector<bool> isHub;
+
+    /**
+     * Records a newly appended node of a hub vertex in the edge index.
+     *
+     * @param u The hub vertex the node belongs to.
+     * @param node The node that was appended to u's adjacency list.
+     * @param previous The node before it, or nullptr if it is the head.
+     */
+    void indexEdge(const int u, Node *node, Node *previous) {
+        EdgeRef *ref = edgeIndex.find(u, node->data);
+        if (ref) {
+            ref->multiplicity++;
+        } else {
+            edgeIndex.insert(u, node->data, EdgeRef{node, previous, 1});
+        }
+    }
+
+    /**
+     * Turns a vertex into a hub by indexing every one of its outgoing edges.
+     *
+     * @param u The vertex to promote.
+     */
+    void promoteToHub(const int u) {
+        isHub[u] = true;
+        Node *previous = nullptr;
+        for (Node &edge : adjacencyList[u]) {
+            indexEdge(u, &edge, previous);
+            previous = &edge;
+        }
+    }
+
+    /**
+     * Removes every outgoing edge of a hub vertex from the edge index and demotes it to a plain vertex.
+     *
+     * @param u The vertex to demote. Vertices that are not hubs are ignored.
+     */
+    void unindexVertex(const int u) {
+        if (!isHub[u]) return;
+        for (const Node &edge : adjacencyList[u]) {
+            edgeIndex.erase(u, edge.data);
+        }
+        isHub[u] = false;
+    }
+
+    /**
+     * Finds the first node of the edge (u, v): through the edge index if u is a hub, otherwise by scanning u's list.
+     *
+     * @param u The source vertex. Must be in range.
+     * @param v The target vertex.
+     * @param previous Set to the node before the returned one, or nullptr if it is the head.
+     * @return The node of the edge, or nullptr if there is no such edge.
+     */
+    Node *findEdge(const int u, const int v, Node *&previous) const {
+        if (isHub[u]) {
+            const EdgeRef *ref = edgeIndex.find(u, v);
+            if (!ref) return nullptr;
+            previous = ref->previous;
+            return ref->node;
+        }
+        previous = nullptr;
+        return adjacencyList[u].findNode(v, previous);
+    }
+
+    /**
+     * Removes the first edge (u, v) from u's adjacency list, keeping the edge index in sync.
+     * Costs O(1) if u is a hub (unless it has parallel roads to v) and O(degree of u) otherwise.
+     * Prints an error message if the list is empty or holds no such edge.
+     * The reverse adjacency list of v is left to the caller.
+     *
+     * @param u The source vertex. Must be in range.
+     * @param v The target vertex.
+     * @return True if an edge was removed, false otherwise.
+     */
+    bool removeEdge(const int u, const int v) {
+        LinkedList &list = adjacencyList[u];
+        if (list.isEmpty()) {
+            cout << "Error: List is empty." << endl;
+            return false;
+        }
+
+        Node *previous;
+        Node *node = findEdge(u, v, previous);
+        if (!node) {
+            cout << "Error: Value not found." << endl;
+            return false;
+        }
+
+        if (isHub[u]) {
+            EdgeRef *ref = edgeIndex.find(u, v);
+            if (ref->multiplicity == 1) {
+                edgeIndex.erase(u, v);
+            } else {
+                // A parallel road remains: index the next node holding v instead
+                Node *nextPrevious = node;
+                ref->node = list.findNode(v, nextPrevious);
+                ref->previous = nextPrevious == node ? previous : nextPrevious;
+                ref->multiplicity--;
+            }
+
+            // The node after the removed one gets a new predecessor
+            Node *following = node->next;
+            if (following) {
+                EdgeRef *followingRef = edgeIndex.find(u, following->data);
+                if (followingRef && followingRef->node == following) {
+                    followingRef->previous = previous;
+                }
+            }
+        }
+        list.removeAfter(previous);
+        return true;
+    }
+
+    /**
+     * Removes one record of the edge (u, v) from the reverse adjacency list of v.
+     * Costs O(in-degree of v).
+     *
+     * @param v The target vertex of the edge.
+     * @param u The source vertex of the edge. The edge must be recorded.
+     */
+    void unlinkIncoming(const int v, const int u) {
+        Node *previous = nullptr;
+        incomingList[v].findNode(u, previous);
+        incomingList[v].removeAfter(previous);
+    }
+
+    /**
+     * Appends a removed or slowed edge to the journal under the current version, overwriting the oldest
+     * change once the journal is full.
+     *
+     * @param u The source vertex of the edge.
+     * @param v The target vertex of the edge.
+     */
+    void recordSlowedEdge(const int u, const int v) {
+        const EdgeChange change{version, u, v};
+        if (journal.getSize() < JOURNAL_CAPACITY) {
+            journal.push_back(change);
+        } else {
+            journalDropped = journal[journalNext].version;
+            journal[journalNext] = change;
+        }
+        journalNext = (journalNext + 1) % JOURNAL_CAPACITY;
+    }
+
+    /**
+     * Drops every node, list and index entry in bulk: the lists forget their nodes and the pool frees its slabs.
+     * Leaves the graph without vertices; numVertices is left to the caller.
+     */
+    void releaseAdjacency() {
+        for (LinkedList &list : adjacencyList) {
+            list.abandonNodes();
+        }
+        for (LinkedList &list : incomingList) {
+            list.abandonNodes();
+        }
+        adjacencyList.clear();
+        incomingList.clear();
+        nodePool.release();
+        edgeIndex.clear();
+    }
+
+    /**
+     * Fills the (empty) adjacency list with a copy of another graph's lists. The number of edges is known up front,
+     * so all copied nodes are written sequentially into a single slab of this graph's pool.
+     * The edge index is rebuilt for the copied hub vertices.
+     *
+     * @param other The graph to copy the adjacency lists from.
+     */
+    void copyAdjacency(const Graph &other) {
+        nodePool.reserve(other.nodePool.getLiveCount());
+        adjacencyList.reserve(other.numVertices);
+        incomingList.reserve(other.numVertices);
+        for (const LinkedList &list : other.adjacencyList) {
+            adjacencyList.emplace_back(list, &nodePool);
+        }
+        for (const LinkedList &list : other.incomingList) {
+            incomingList.emplace_back(list, &nodePool);
+        }
+        isHub = Vector<bool>(other.numVertices, false);
+        for (int u = 0; u < other.numVertices; u++) {
+            if (other.isHub[u]) {
+                promoteToHub(u);
+            }
+        }
+    }
 
     /**
      * Constructs a graph with the specified number of vertices.
@@ -28,7 +307,10 @@ class Graph {
      * @return A new Graph object with initialized adjacency lists.
      */
 public:
-    explicit Graph(const int nVert) : adjacencyList(nVert), numVertices(nVert) {}
+    explicit Graph(const int nVert) : adjacencyList(nVert, LinkedList(&nodePool)),
+                                      incomingList(nVert, LinkedList(&nodePool)), numVertices(nVert), version(0),
+                                      snapshotVersion(~0ULL), journalNext(0), journalDropped(0), lastShortening(0),
+                                      isHub(nVert, false) {}
 
     /**
      * Copy constructor for the Graph class.
@@ -36,7 +318,10 @@ public:
      * @param other The Graph object to be copied.
      * @return A new instance of the Graph class that is a copy of the provided Graph.
      */
-    Graph(const Graph &other) : adjacencyList(other.adjacencyList), numVertices(other.numVertices) {}
+    Graph(const Graph &other) : numVertices(other.numVertices), version(0), snapshotVersion(~0ULL), journalNext(0),
+                                journalDropped(0), lastShortening(0) {
+        copyAdjacency(other);
+    }
 
     /**
      * Assignment operator for the Graph class.
@@ -49,12 +334,51 @@ public:
             return *this;
         }
 
-        adjacencyList = other.adjacencyList;
+        releaseAdjacency();
+        copyAdjacency(other);
         numVertices = other.numVertices;
+        version++;
+        lastShortening = version;
 
         return *this;
     }
 
+    /**
+     * Replaces the whole graph with the one described by CSR arrays, e.g. read from a binary road network file.
+     * The outgoing edges of vertex u are [offsets[u], offsets[u + 1]) of targets and weights, in list order.
+     * All nodes are allocated up front from a single slab, so this is much cheaper than calling addEdge per edge.
+     *
+     * @param nVert The number of vertices.
+     * @param offsets The nVert + 1 edge offsets, starting at 0 and non-decreasing.
+     * @param targets The target of every edge. Every target must be in the range [0, nVert).
+     * @param weights The weight of every edge.
+     */
+    void assignFromCSR(const int nVert, const int *offsets, const int *targets, const float *weights) {
+        releaseAdjacency();
+        numVertices = nVert;
+        nodePool.reserve(2 * offsets[nVert]);
+        adjacencyList = Vector<LinkedList>(nVert, LinkedList(&nodePool));
+        incomingList = Vector<LinkedList>(nVert, LinkedList(&nodePool));
+        isHub = Vector<bool>(nVert, false);
+
+        // Outgoing lists first so each one occupies a contiguous run of the slab, then the reverse lists
+        for (int u = 0; u < nVert; u++) {
+            for (int e = offsets[u]; e < offsets[u + 1]; e++) {
+                adjacencyList[u].insertAtEnd(targets[e], weights[e]);
+            }
+            if (adjacencyList[u].getSize() > HUB_DEGREE) {
+                promoteToHub(u);
+            }
+        }
+        for (int u = 0; u < nVert; u++) {
+            for (int e = offsets[u]; e < offsets[u + 1]; e++) {
+                incomingList[targets[e]].insertAtEnd(u, 0.0f);
+            }
+        }
+        version++;
+        lastShortening = version;
+    }
+
     /**
      * Retrieves the number of vertices in the graph.
      * @return The number of vertices in the graph.
@@ -63,6 +387,58 @@ public:
         return numVertices;
     }
 
+    /**
+     * Returns the modification counter of the graph.
+     * The value changes whenever an edge or node is added, removed or reweighted.
+     *
+     * @return The current version of the graph.
+     */
+    unsigned long long getVersion() const {
+        return version;
+    }
+
+    /**
+     * Reports every edge that was removed or made slower after a given version, e.g. so a route cache can drop
+     * exactly the routes that used them. Any other change since then (an added edge, a lower weight, a
+     * replacement of the whole graph) can make routes shorter anywhere, so the call reports nothing and returns
+     * false instead; so it does when the journal no longer reaches back far enough. Added vertices are not
+     * reported at all, since a vertex without edges changes no route.
+     *
+     * @param since A version returned by getVersion earlier.
+     * @param visit Called as visit(u, v) for each removed or slowed edge, possibly more than once per edge.
+     * @return True if every change since the version was reported, false if callers must assume all routes changed.
+     */
+    template<typename Visit>
+    bool forEachSlowedEdgeSince(const unsigned long long since, Visit visit) const {
+        if (lastShortening > since || journalDropped > since) return false;
+
+        // Walk back from the newest change until reaching changes the caller has already seen
+        int slot = journalNext;
+        for (int i = 0; i < journal.getSize(); i++) {
+            slot = (slot == 0 ? journal.getSize() : slot) - 1;
+            if (journal[slot].version <= since) break;
+            visit(journal[slot].u, journal[slot].v);
+        }
+        return true;
+    }
+
+    /**
+     * Returns a CSR snapshot of the current adjacency lists, rebuilding it first if the graph
+     * has changed since it was last built. Read-only algorithms should traverse this snapshot.
+     *
+     * The rebuild is not synchronised, so fetch the snapshot once before sharing the graph between threads.
+     * Edits made through the raw Node pointers of getAdjacencyList bypass the version counter and are not seen.
+     *
+     * @return A const reference to the up-to-date snapshot.
+     */
+    const CSRGraph &getSnapshot() const {
+        if (snapshotVersion != version) {
+            snapshot.build(adjacencyList, numVertices);
+            snapshotVersion = version;
+        }
+        return snapshot;
+    }
+
     /**
     * @brief Returns a const reference to the adjacency list of a specific vertex.
     *
@@ -84,6 +460,7 @@ public:
 
     /**
      * Adds an edge between two vertices in the graph with a specified weight.
+     * Appending is O(1); once u has more than HUB_DEGREE edges they are indexed for O(1) lookup.
      *
      * @param u The starting vertex of the edge. Must be within valid vertex range.
      * @param v The ending vertex of the edge. Must be within valid vertex range.
@@ -95,7 +472,17 @@ public:
             return;
         }
 
-        adjacencyList[u].insertAtEnd(v, weight);
+        LinkedList &list = adjacencyList[u];
+        Node *previous = list.getTail();
+        Node *node = list.insertAtEnd(v, weight);
+        if (isHub[u]) {
+            indexEdge(u, node, previous);
+        } else if (list.getSize() > HUB_DEGREE) {
+            promoteToHub(u);
+        }
+        incomingList[v].insertAtEnd(u, 0.0f);
+        version++;
+        lastShortening = version;
     }
 
     /**
@@ -106,18 +493,17 @@ public:
      * total number of vertices by one.
      */
     void addNode() {
-        if (numVertices > 26) {
-            cout << "Error: Too many vertices." << endl;
-            return;
-        }
-
-        adjacencyList.push_back(LinkedList());
+        adjacencyList.emplace_back(&nodePool);
+        incomingList.emplace_back(&nodePool);
+        isHub.push_back(false);
         numVertices++;
+        version++;
     }
 
     /**
      * Deletes the edge between two vertices u and v in the graph.
      * If either vertex u or v is out of range, an error message is displayed.
+     * Costs O(1) for hub vertices and O(degree of u) otherwise.
      *
      * @param u The starting vertex of the edge to be deleted.
      * @param v The ending vertex of the edge to be deleted.
@@ -128,11 +514,16 @@ public:
             return;
         }
 
-        adjacencyList[u].deleteByValue(v);
+        version++;
+        if (removeEdge(u, v)) {
+            unlinkIncoming(v, u);
+            recordSlowedEdge(u, v);
+        }
     }
 
     /**
-     * Deletes a node from the graph and removes all associated edges.
+     * Deletes a node from the graph and removes all associated edges, including every parallel road into it.
+     * Only the node's neighbours are visited: the edges into it are found through the reverse adjacency list.
      *
      * @param u The index of the node to be deleted. Must be within the range [0, numVertices).
      * If the index is out of range, an error message is displayed and no action is taken.
@@ -143,25 +534,53 @@ public:
             return;
         }
 
+        version++;
+        // Outgoing edges (including self-loops) are dropped from the reverse lists of their targets first
+        for (const Node &edge : adjacencyList[u]) {
+            unlinkIncoming(edge.data, u);
+            recordSlowedEdge(u, edge.data);
+        }
+        unindexVertex(u);
         adjacencyList[u].deleteList();
 
-        for (int i = 0; i < numVertices; ++i) {
-            if (i != u) {
-                adjacencyList[i].deleteByValue(u);
+        for (const Node &edge : incomingList[u]) {
+            if (removeEdge(edge.data, u)) {
+                recordSlowedEdge(edge.data, u);
             }
         }
+        incomingList[u].deleteList();
     }
 
+    /**
+     * Sets the weight of the edge from u to v, adding the edge if it does not exist yet.
+     * Finding the edge is O(1) for hub vertices and O(degree of u) otherwise, so live weight updates
+     * (e.g. from a congestion feed) stay cheap even at intersections with hundreds of roads.
+     * If there are parallel roads from u to v, only the first one is updated.
+     *
+     * @param u The starting vertex of the edge. Must be within valid vertex range.
+     * @param v The ending vertex of the edge. Must be within valid vertex range.
+     * @param weight The new weight of the edge.
+     */
     void setEdgeWeight(const int u, const int v, const float weight) {
-        Node* edge = adjacencyList[u].getHead();
-        while (edge != nullptr) {
-            if (edge->data == v) {
-                edge->weight = weight;
-                return;
-            }
-            edge = edge->next;
+        if (u < 0 || v < 0 || u >= numVertices || v >= numVertices) {
+            cout << "Error: Vertices out of range." << endl;
+            return;
+        }
+
+        Node *previous;
+        Node *edge = findEdge(u, v, previous);
+        if (!edge) {
+            addEdge(u, v, weight);
+            return;
+        }
+        const float oldWeight = edge->weight;
+        edge->weight = weight;
+        version++;
+        if (weight < oldWeight) {
+            lastShortening = version;
+        } else if (weight > oldWeight) {
+            recordSlowedEdge(u, v);
         }
-        adjacencyList[u].insertAtEnd(v, weight);
     }
 
     /**
@@ -181,7 +600,12 @@ public:
         }
     }
 
-    void bfs() {
+    /**
+     * Prints the vertices in breadth-first order, starting a new traversal from every unvisited vertex.
+     * Runs on the CSR snapshot.
+     */
+    void bfs() const {
+        const CSRGraph &network = getSnapshot();
         Vector<bool> visited(numVertices, false);
         Queue<int> queue;
 
@@ -194,15 +618,12 @@ public:
                     int current = queue.dequeue();
                     cout << current << " ";
 
-                    LinkedList& adjList = adjacencyList[current];
-                    Node* temp = adjList.getHead();
-                    while (temp != nullptr) {
-                        int neighbor = temp->data;
+                    for (int e = network.edgeBegin(current); e < network.edgeEnd(current); ++e) {
+                        int neighbor = network.getTarget(e);
                         if (!visited[neighbor]) {
                             queue.enqueue(neighbor);
                             visited[neighbor] = true;
                         }
-                        temp = temp->next;
                     }
                 }
             }
@@ -210,7 +631,12 @@ public:
         cout << endl;
     }
 
-    void dfs() {
+    /**
+     * Prints the vertices in depth-first order, starting a new traversal from every unvisited vertex.
+     * Runs on the CSR snapshot.
+     */
+    void dfs() const {
+        const CSRGraph &network = getSnapshot();
         Vector<bool> visited(numVertices, false);
         Stack<int> stack;
 
@@ -223,15 +649,12 @@ public:
                     int current = stack.pop();
                     cout << current << " ";
 
-                    LinkedList& adjList = adjacencyList[current];
-                    Node* temp = adjList.getHead();
-                    while (temp != nullptr) {
-                        int neighbor = temp->data;
+                    for (int e = network.edgeBegin(current); e < network.edgeEnd(current); ++e) {
+                        int neighbor = network.getTarget(e);
                         if (!visited[neighbor]) {
                             stack.push(neighbor);
                             visited[neighbor] = true;
                         }
-                        temp = temp->next;
                     }
                 }
             }
@@ -1,43 +1,51 @@
 #include <iostream>
 #include <ctime>
 #include <cstdlib>
+#include <utility>
 
 using namespace std;
 
 /**
  * HashTable class provides a structure for storing and managing entries with unique keys,
  * which represent roads between two nodes identified by integers.
+ *
+ * The table uses open addressing with linear probing over a power-of-two array. Keys are scrambled
+ * by mixKey before being reduced to a slot, and the table doubles automatically once the share of
+ * used slots passes the configured load factor, so it scales to millions of road segments.
  */
 class HashTable {
-    static constexpr int HT_SIZE = 653; /**
+    /**
+     * The number of slots a newly constructed table starts with. Always a power of two.
+     */
+    static constexpr int INITIAL_SIZE = 64;
+    /**
      * Represents a constant or sentinel value that is used as a placeholder
      * for an empty or null key in data structures or algorithms where
      * differentiation between a null key and an absent key is necessary.
      *
-     * Typically used in hashmap or hashtable implementations to indicate
-     * a slot that has been previously occupied but is currently empty,
-     * distinguishing it from a never-occupied slot.
+     * A probe sequence stops at the first slot holding this key.
      */
-    static constexpr int EMPTY_KEY = -1;
+    static constexpr long long EMPTY_KEY = -1;
     /**
      * Represents a special marker key indicating a deleted entry within the hash table.
      * This is used to distinguish between empty and previously used slots that can be re-used.
+     * Probe sequences continue past these tombstones, and a rehash drops them.
      */
-    static constexpr int DELETED_KEY = -2;
+    static constexpr long long DELETED_KEY = -2;
 
     /**
      * @struct HashEntry
      * @brief Represents an entry in a hash table.
      *
      * This structure is used to store key-value pairs in a hash table,
-     * where the key is an integer and the values are counts for regular
+     * where the key is a 64-bit road key and the values are counts for regular
      * and emergency entries*/
     struct HashEntry {
         /**
          * Represents the key value used in the hash table entry.
-         * This key is a unique identifier for each entry in the hash table.
+         * This key is the road (u, v) packed by edgeKey, so it is unique for every pair of vertex indices.
          */
-        int key;
+        long long key;
         /**
          * Stores the count of regular events or accesses associated with a specific hash entry.
          * This variable helps track the frequency or usage of an entry under non-emergency conditions.
@@ -53,114 +61,153 @@ class HashTable {
     };
 
     /**
-     * A 2D array used for storing data in a tabular format.
-     * The 'table' variable represents a matrix where each entry can hold a specific type of data.
-     * This structure is often used for various computations or data organization tasks.
+     * The slots of the table. The number of slots is always a power of two.
+     */
+    Vector<HashEntry> table;
+    /**
+     * @brief Tracks the number of live roads in the hash table.
      *
-     * Common use cases include:
-     * - Performing mathematical operations on a matrix.
-     * - Organizing and accessing data in rows and columns.
-     * - Implementing algorithms that require a grid or matrix form.
+     * Incremented when a new road is inserted and decremented when one is removed.
+     */
+    int occupied;
+    /**
+     * The number of slots holding DELETED_KEY. Tombstones lengthen probe sequences, so they count
+     * towards the load factor until the next rehash clears them.
+     */
+    int tombstones;
+    /**
+     * The number of slots minus one, used to reduce mixed hashes to slot indices.
+     */
+    int mask;
+    /**
+     * The share of slots (live roads plus tombstones) above which the table is rehashed.
+     */
+    float maxLoadFactor;
+
+    /**
+     * Computes the home slot for a given key.
      *
-     * It's important to ensure that all operations on this variable maintain its integrity,
-     * respecting its dimensions and data type consistency.
+     * @param key The 64-bit road key that requires hashing.
+     * @return The slot index where the probe sequence for the key starts.
      */
-    HashEntry table[HT_SIZE];
+    int hashFunction(long long key) const {
+        return static_cast<int>(mixKey(static_cast<unsigned long long>(key)) & mask);
+    }
+
     /**
-     * @brief Tracks the number of occupied slots in the hash table.
+     * Creates a fresh array of empty slots.
      *
-     * This variable is incremented whenever a new entry is successfully inserted
-     * into the hash table and decremented when an entry is removed. It acts as
-     * a counter to keep track of how many slots are occupied at any given time,
-     * providing a way to monitor the hash table's load factor.
+     * @param size The number of slots. Must be a power of two.
+     * @return A vector of empty entries.
      */
-    int occupied;
+    static Vector<HashEntry> emptyTable(const int size) {
+        return Vector<HashEntry>(size, HashEntry{EMPTY_KEY, 0, 0});
+    }
+
     /**
-     * @brief Represents the number of random probes to be executed.
+     * Moves every live road into a new array of the given size, dropping all tombstones.
      *
-     * The `randomProbes` variable is utilized to determine how many times
-     * a certain operation or function should be randomly invoked or tested.
-     * This is commonly used in scenarios where random sampling or stochastic
-     * testing is performed to verify functionality, ascertain performance,
-     * or gather statistical data.
+     * @param newSize The new number of slots. Must be a power of two larger than the number of live roads.
      */
-    int randomProbes[HT_SIZE];
+    void rehash(const int newSize) {
+        Vector<HashEntry> oldTable = std::move(table);
+        table = emptyTable(newSize);
+        mask = newSize - 1;
+        tombstones = 0;
+
+        for (const HashEntry &entry : oldTable) {
+            if (entry.key >= 0) {
+                int index = hashFunction(entry.key);
+                while (table[index].key != EMPTY_KEY) {
+                    index = (index + 1) & mask;
+                }
+                table[index] = entry;
+            }
+        }
+    }
 
     /**
-     * Computes the hash value for a given key using the modulo operation.
+     * Finds the slot holding a given key.
      *
-     * @param key The integer key that requires hashing.
-     * @return The hash value calculated as the remainder of the division of
-     *         the key by HT_SIZE, which determines the index in the hash table.
+     * @param key The road key to look for.
+     * @return The slot index, or -1 if the road is not in the table.
      */
-    int hashFunction(int key) const {
-        return key % HT_SIZE;
+    int findIndex(const long long key) const {
+        int index = hashFunction(key);
+        while (table[index].key != EMPTY_KEY) {
+            if (table[index].key == key) return index;
+            index = (index + 1) & mask;
+        }
+        return -1;
     }
 
     /**
-     * Generates a random index within the bounds of the hash table size.
+     * Finds the entry for the road (u, v), printing a message if it is missing.
      *
-     * @return A random index between 0 and HT_SIZE - 1 inclusive.
+     * @param u The first node identifier.
+     * @param v The second node identifier.
+     * @return The slot index of the road, or -1 if it is not in the table.
      */
-    int getRandomIndex() const {
-        return rand() % HT_SIZE;
+    int findRoad(const int u, const int v) const {
+        const int index = findIndex(static_cast<long long>(edgeKey(u, v)));
+        if (index == -1) {
+            cout << "Road (" << u << ", " << v << ") not found in hash table." << endl;
+        }
+        return index;
     }
 
     /**
-     * Constructs a new HashTable object and initializes its entries and probes.
-     * Each entry in the table is set with an EMPTY_KEY and count values are initialized to zero.
-     * Random probes are initialized with random values within the table size range.
-     * The number of occupied entries is initialized to zero.
+     * Constructs a new, empty HashTable.
      *
+     * @param loadFactorLimit The share of used slots above which the table is rehashed. Values outside
+     *                        [0.1, 0.95] are clamped to that range.
      * @return A newly constructed instance of the HashTable class.
      */
 public:
-    HashTable() {
-        for (int i = 0; i < HT_SIZE; i++) {
-            table[i].key = EMPTY_KEY;
-            table[i].regularCount = 0;
-            table[i].emergencyCount = 0;
-            randomProbes[i] = rand() % HT_SIZE;
-        }
-        occupied = 0;
+    explicit HashTable(const float loadFactorLimit = 0.7f)
+        : table(emptyTable(INITIAL_SIZE)), occupied(0), tombstones(0), mask(INITIAL_SIZE - 1),
+          maxLoadFactor(loadFactorLimit) {
+        if (maxLoadFactor < 0.1f) maxLoadFactor = 0.1f;
+        if (maxLoadFactor > 0.95f) maxLoadFactor = 0.95f;
     }
 
     /**
      * Inserts a road connection between nodes u and v into the hash table.
-     * Utilizes random probing to handle collisions.
+     * Utilizes linear probing to handle collisions and reuses the first tombstone on the probe
+     * sequence. Inserting a road that is already present has no effect.
      *
      * @param u The first node identifier.
      * @param v The second node identifier.
      */
     void insert(int u, int v) {
-        int key = u * 100 + v;
-        int index = hashFunction(key);
-        if (table[index].key == EMPTY_KEY || table[index].key == DELETED_KEY) {
-            table[index].key = key;
-            table[index].regularCount = 0;
-            table[index].emergencyCount = 0;
-            occupied++;
-            return;
-        }
-        if (table[index].key == key) {
-            // Key already exists, no action needed
-            return;
+        if (static_cast<float>(occupied + tombstones + 1) > maxLoadFactor * table.getSize()) {
+            // Grow only if live roads need the room; otherwise rehashing at the same size clears the tombstones
+            const bool crowded = static_cast<float>(occupied + 1) > maxLoadFactor * table.getSize() / 2;
+            rehash(crowded ? table.getSize() * 2 : table.getSize());
         }
-        // Collision occurred, start random probing
-        int attempts = 0;
-        const int MAX_ATTEMPTS = HT_SIZE;
-        while (attempts < MAX_ATTEMPTS) {
-            int randIndex = randomProbes[attempts] % HT_SIZE;
-            if (table[randIndex].key == EMPTY_KEY || table[randIndex].key == DELETED_KEY) {
-                table[randIndex].key = key;
-                table[randIndex].regularCount = 0;
-                table[randIndex].emergencyCount = 0;
-                occupied++;
+
+        long long key = static_cast<long long>(edgeKey(u, v));
+        int index = hashFunction(key);
+        int firstTombstone = -1;
+        while (table[index].key != EMPTY_KEY) {
+            if (table[index].key == key) {
+                // Key already exists, no action needed
                 return;
             }
-            attempts++;
+            if (table[index].key == DELETED_KEY && firstTombstone == -1) {
+                firstTombstone = index;
+            }
+            index = (index + 1) & mask;
         }
-        cout << "Hash table is full, cannot insert road (" << static_cast<char>(u + 65) << ", " << static_cast<char>(v + 65) << ")" << endl;
+
+        if (firstTombstone != -1) {
+            index = firstTombstone;
+            tombstones--;
+        }
+        table[index].key = key;
+        table[index].regularCount = 0;
+        table[index].emergencyCount = 0;
+        occupied++;
     }
 
     /**
@@ -172,34 +219,14 @@ public:
      * @param v The second endpoint of the road (integer representation of node).
      */
     void remove(int u, int v) {
-        int key = u * 100 + v;
-        int index = hashFunction(key);
-        if (table[index].key == key) {
-            table[index].key = DELETED_KEY;
-            table[index].regularCount = 0;
-            table[index].emergencyCount = 0;
-            occupied--;
-            return;
-        }
-        if (table[index].key == EMPTY_KEY) {
-            cout << "Road (" << static_cast<char>(u + 65) << ", " << static_cast<char>(v + 65) << ") not found in hash table." << endl;
-            return;
-        }
-        // Start random probing to find the key
-        int attempts = 0;
-        const int MAX_ATTEMPTS = HT_SIZE;
-        while (attempts < MAX_ATTEMPTS) {
-            int randIndex = randomProbes[attempts] % HT_SIZE;
-            if (table[randIndex].key == key) {
-                table[randIndex].key = DELETED_KEY;
-                table[randIndex].regularCount = 0;
-                table[randIndex].emergencyCount = 0;
-                occupied--;
-                return;
-            }
-            attempts++;
-        }
-        cout << "Road (" << static_cast<char>(u + 65) << ", " << static_cast<char>(v + 65) << ") not found in hash table." << endl;
+        int index = findRoad(u, v);
+        if (index == -1) return;
+
+        table[index].key = DELETED_KEY;
+        table[index].regularCount = 0;
+        table[index].emergencyCount = 0;
+        occupied--;
+        tombstones++;
     }
 
     /**
@@ -211,133 +238,97 @@ public:
      * @return The number of counts for the specified road: emergency if isEmergency is true, otherwise regular. Returns -1 if the road is not found.
      */
     int search(int u, int v, bool isEmergency) const {
-        int key = u * 100 + v;
-        int index = hashFunction(key);
-        if (table[index].key == key) {
-            return (isEmergency) ? table[index].emergencyCount : table[index].regularCount;
-        }
-        if (table[index].key == EMPTY_KEY) {
-            cout << "Road (" << static_cast<char>(u + 65) << ", " << static_cast<char>(v + 65) << ") not found in hash table." << endl;
-            return -1; // Indicate not found
-        }
-        // Start random probing to find the key
-        int attempts = 0;
-        const int MAX_ATTEMPTS = HT_SIZE;
-        while (attempts < MAX_ATTEMPTS) {
-            int randIndex = randomProbes[attempts] % HT_SIZE;
-            if (table[randIndex].key == key) {
-                return (isEmergency) ? table[randIndex].emergencyCount : table[randIndex].regularCount;
-            }
-            attempts++;
-        }
-        cout << "Road (" << static_cast<char>(u + 65) << ", " << static_cast<char>(v + 65) << ") not found in hash table." << endl;
-        return -1; // Indicate not found
+        int index = findRoad(u, v);
+        if (index == -1) return -1; // Indicate not found
+        return (isEmergency) ? table[index].emergencyCount : table[index].regularCount;
     }
 
     /**
-     * Increments the current count value by a specified amount.
+     * Increments the regular or emergency count of a road by one.
      *
-     * @param currentCount The current value of the count before incrementation.
-     * @param incrementValue The value to add to the current count.
-     * @return The new count value after incrementation.
+     * @param u The first endpoint of the road.
+     * @param v The second endpoint of the road.
+     * @param isEmergency True to increment the emergency count, false for the regular count.
      */
     void incrementCount(int u, int v, bool isEmergency) {
-        int key = u * 100 + v;
-        int index = hashFunction(key);
-        if (table[index].key == key) {
-            if (isEmergency) {
-                table[index].emergencyCount++;
-            } else {
-                table[index].regularCount++;
-            }
-            return;
-        }
-        if (table[index].key == EMPTY_KEY) {
-            cout << "Road (" << static_cast<char>(u + 65) << ", " << static_cast<char>(v + 65) << ") not found in hash table." << endl;
-            return;
+        int index = findRoad(u, v);
+        if (index == -1) return;
+
+        if (isEmergency) {
+            table[index].emergencyCount++;
+        } else {
+            table[index].regularCount++;
         }
-        // Start random probing to find the key
-        int attempts = 0;
-        const int MAX_ATTEMPTS = HT_SIZE;
-        while (attempts < MAX_ATTEMPTS) {
-            int randIndex = randomProbes[attempts] % HT_SIZE;
-            if (table[randIndex].key == key) {
-                if (isEmergency) {
-                    table[randIndex].emergencyCount++;
-                } else {
-                    table[randIndex].regularCount++;
-                }
-                return;
-            }
-            attempts++;
+    }
+
+    /**
+     * Adds a number of trips to the regular or emergency count of a road in one update, e.g. when merging
+     * counts that were gathered elsewhere.
+     *
+     * @param u The first endpoint of the road.
+     * @param v The second endpoint of the road.
+     * @param amount The number of trips to add.
+     * @param isEmergency True to add to the emergency count, false for the regular count.
+     */
+    void addCount(int u, int v, int amount, bool isEmergency) {
+        int index = findRoad(u, v);
+        if (index == -1) return;
+
+        if (isEmergency) {
+            table[index].emergencyCount += amount;
+        } else {
+            table[index].regularCount += amount;
         }
-        cout << "Road (" << static_cast<char>(u + 65) << ", " << static_cast<char>(v + 65) << ") not found in hash table." << endl;
     }
 
     /**
-     * Decrements the current count by a specified value.
+     * Decrements the regular or emergency count of a road by one, never going below zero.
      *
-     * @param decrementValue The value by which the count should be decreased.
-     *                       Must be a positive integer.
+     * @param u The first endpoint of the road.
+     * @param v The second endpoint of the road.
+     * @param isEmergency True to decrement the emergency count, false for the regular count.
      */
     void decrementCount(int u, int v, bool isEmergency) {
-        int key = u * 100 + v;
-        int index = hashFunction(key);
-        if (table[index].key == key) {
-            if (isEmergency) {
-                if (table[index].emergencyCount > 0) {
-                    table[index].emergencyCount--;
-                }
-            } else {
-                if (table[index].regularCount > 0) {
-                    table[index].regularCount--;
-                }
+        int index = findRoad(u, v);
+        if (index == -1) return;
+
+        if (isEmergency) {
+            if (table[index].emergencyCount > 0) {
+                table[index].emergencyCount--;
+            }
+        } else {
+            if (table[index].regularCount > 0) {
+                table[index].regularCount--;
             }
-            return;
-        }
-        if (table[index].key == EMPTY_KEY) {
-            cout << "Road (" << static_cast<char>(u + 65) << ", " << static_cast<char>(v + 65) << ") not found in hash table." << endl;
-            return;
         }
-        // Start random probing to find the key
-        int attempts = 0;
-        const int MAX_ATTEMPTS = HT_SIZE;
-        while (attempts < MAX_ATTEMPTS) {
-            int randIndex = randomProbes[attempts] % HT_SIZE;
-            if (table[randIndex].key == key) {
-                if (isEmergency) {
-                    if (table[randIndex].emergencyCount > 0) {
-                        table[randIndex].emergencyCount--;
-                    }
-                } else {
-                    if (table[randIndex].regularCount > 0) {
-                        table[randIndex].regularCount--;
-                    }
-                }
-                return;
+    }
+
+    /**
+     * Displays every road in the table with its regular and emergency counts, using vertex indices.
+     */
+    void display() const {
+        for (const HashEntry &entry : table) {
+            if (entry.key >= 0) {
+                int u = static_cast<int>(entry.key >> 32);
+                int v = static_cast<int>(entry.key & 0xffffffffLL);
+                cout << "Road (" << u << ", " << v << ") - Regular Count: " << entry.regularCount
+                     << " - Emergency Count: " << entry.emergencyCount << endl;
             }
-            attempts++;
         }
-        cout << "Road (" << static_cast<char>(u + 65) << ", " << static_cast<char>(v + 65) << ") not found in hash table." << endl;
     }
 
     /**
-     * @brief Displays a given message or output.
+     * Displays every road with its counts, printing intersection names instead of vertex indices.
      *
-     * This function is responsible for presenting information to the user
-     * or logging system. The specific implementation of how the display
-     * occurs (e.g., console output, GUI, log file) is dependent on the
-     * context in which this function is used.
-     *
-     * @param message The content or information to be displayed.
+     * @param intersections The index used to turn vertex indices back into intersection names.
      */
-    void display() const {
-        for (int i = 0; i < HT_SIZE; i++) {
-            if (table[i].key != EMPTY_KEY && table[i].key != DELETED_KEY) {
-                int u = table[i].key / 100;
-                int v = table[i].key % 100;
-                cout << "Road (" << static_cast<char>(u + 65) << ", " << static_cast<char>(v + 65) << ") - Regular Count: " << table[i].regularCount
-                     << " - Emergency Count: " << table[i].emergencyCount << endl;
+    void display(const IntersectionIndex &intersections) const {
+        for (const HashEntry &entry : table) {
+            if (entry.key >= 0) {
+                int u = static_cast<int>(entry.key >> 32);
+                int v = static_cast<int>(entry.key & 0xffffffffLL);
+                cout << "Road (" << intersections.getName(u) << ", " << intersections.getName(v) << ") - Regular Count: "
+                     << entry.regularCount << " - Emergency Count: " << entry.emergencyCount << endl;
             }
         }
     }
@@ -355,39 +346,26 @@ public:
      *         counts if the road is found. Returns -1 if the road is not found.
      */
     float calculateDensity(int u, int v) const {
-        int key = u * 100 + v;
-        int index = hashFunction(key);
-        if (table[index].key == key) {
-            // Calculate density as the sum of regular and emergency counts
-            return table[index].regularCount + table[index].emergencyCount;
-        }
-        if (table[index].key == EMPTY_KEY) {
-            cout << "Road (" << static_cast<char>(u + 65) << ", " << static_cast<char>(v + 65) << ") not found in hash table." << endl;
-            return -1; // Indicate not found
-        }
-        // Start random probing to find the key
-        int attempts = 0;
-        const int MAX_ATTEMPTS = HT_SIZE;
-        while (attempts < MAX_ATTEMPTS) {
-            int randIndex = randomProbes[attempts] % HT_SIZE;
-            if (table[randIndex].key == key) {
-                return table[randIndex].regularCount + table[randIndex].emergencyCount;
-            }
-            attempts++;
-        }
-        cout << "Road (" << static_cast<char>(u + 65) << ", " << static_cast<char>(v + 65) << ") not found in hash table." << endl;
-        return -1; // Indicate not found
+        int index = findRoad(u, v);
+        if (index == -1) return -1; // Indicate not found
+        // Calculate density as the sum of regular and emergency counts
+        return table[index].regularCount + table[index].emergencyCount;
     }
 
     /**
-     * Computes the load factor of the data structure, which is a measure
-     * of how full it is. The load factor is typically defined as the ratio
-     * of the number of elements stored in the structure to the total
-     * capacity of the structure.
+     * Computes the load factor of the table: the number of live roads divided by the number of slots.
      *
-     * @return The load factor as a double.
+     * @return The load factor as a float.
      */
     float loadFactor() const {
-        return static_cast<float>(occupied) / HT_SIZE;
+        return static_cast<float>(occupied) / table.getSize();
+    }
+
+    /**
+     * Returns the number of roads currently stored in the table.
+     * @return The number of live roads.
+     */
+    int getSize() const {
+        return occupied;
     }
 };
@@ -0,0 +1,297 @@
+#include <iostream>
+#include <string>
+#include <fstream>
+#include <sstream>
+
+using namespace std;
+
+template<typename P = float>
+/**
+ * A binary min-heap of integer keys in the range [0, capacity), each queued at most once with a priority.
+ *
+ * Alongside the heap array, the position of every key inside it is tracked, so the priority of a key that
+ * is already queued can be lowered or raised in O(log n) and membership is answered in O(1). This lets
+ * graph searches keep exactly one entry per vertex instead of queueing lazy duplicates.
+ *
+ * @tparam P Type of the priorities; the smallest priority is extracted first.
+ */
+class IndexedMinHeap {
+    /**
+     * A queued key together with its priority. Keeping the priority inline means sifting compares
+     * neighbouring heap slots without an extra lookup per comparison.
+     */
+    struct Entry {
+        P priority;
+        int key;
+    };
+
+    /**
+     * The queued entries in heap order. The entry with the smallest priority is at index 0.
+     */
+    Vector<Entry> heap;
+    /**
+     * The index of every key inside heap, or -1 if the key is not queued.
+     */
+    Vector<int> positions;
+
+    /**
+     * Places an entry at a heap index and records its new position.
+     *
+     * @param index The heap index to write.
+     * @param entry The entry stored there.
+     */
+    void place(const int index, const Entry &entry) {
+        heap[index] = entry;
+        positions[entry.key] = index;
+    }
+
+    /**
+     * Moves the key at the given heap index towards the root until its parent has a smaller or equal priority.
+     *
+     * @param index The heap index of the key to sift up.
+     */
+    void siftUp(int index) {
+        const Entry entry = heap[index];
+        while (index > 0) {
+            int parentIdx = (index - 1) / 2;
+            if (!(entry.priority < heap[parentIdx].priority)) break;
+            place(index, heap[parentIdx]);
+            index = parentIdx;
+        }
+        place(index, entry);
+    }
+
+    /**
+     * Moves the key at the given heap index towards the leaves until neither child has a smaller priority.
+     *
+     * @param index The heap index of the key to sift down.
+     */
+    void siftDown(int index) {
+        const int count = heap.getSize();
+        const Entry entry = heap[index];
+        while (true) {
+            int child = 2 * index + 1;
+            if (child >= count) break;
+            if (child + 1 < count && heap[child + 1].priority < heap[child].priority) {
+                child++;
+            }
+            if (!(heap[child].priority < entry.priority)) break;
+            place(index, heap[child]);
+            index = child;
+        }
+        place(index, entry);
+    }
+
+    /**
+     * Checks that a key lies in the addressable range, printing an error if it does not.
+     *
+     * @param key The key to check.
+     * @return True if the key is valid, false otherwise.
+     */
+    bool checkKey(const int key) const {
+        if (key < 0 || key >= positions.getSize()) {
+            cout << "Error: Key out of range." << endl;
+            return false;
+        }
+        return true;
+    }
+
+public:
+    /**
+     * Constructs an empty heap that can hold keys in [0, capacity).
+     *
+     * @param capacity The number of distinct keys that can be addressed.
+     */
+    explicit IndexedMinHeap(const int capacity = 0) : positions(capacity, -1) {}
+
+    /**
+     * Grows the addressable key range to [0, capacity). Keys that are already queued stay queued.
+     *
+     * @param capacity The number of distinct keys that must be addressable.
+     */
+    void ensureCapacity(const int capacity) {
+        while (positions.getSize() < capacity) {
+            positions.push_back(-1);
+        }
+        heap.reserve(capacity);
+    }
+
+    /**
+     * Queues a key that is not in the heap yet.
+     *
+     * @param key The key to queue.
+     * @param priority The priority of the key.
+     */
+    void push(const int key, const P &priority) {
+        if (!checkKey(key)) return;
+        if (positions[key] != -1) {
+            cout << "Error: Key already in heap." << endl;
+            return;
+        }
+        heap.push_back({priority, key});
+        siftUp(heap.getSize() - 1);
+    }
+
+    /**
+     * Lowers the priority of a queued key. Priorities that are not lower are ignored.
+     *
+     * @param key The queued key.
+     * @param priority The new, smaller priority.
+     */
+    void decreaseKey(const int key, const P &priority) {
+        if (!checkKey(key)) return;
+        if (positions[key] == -1) {
+            cout << "Error: Key not in heap." << endl;
+            return;
+        }
+        const int index = positions[key];
+        if (!(priority < heap[index].priority)) return;
+        heap[index].priority = priority;
+        siftUp(index);
+    }
+
+    /**
+     * Queues a key, or lowers its priority if it is already queued with a larger one.
+     * This is the relaxation step of Dijkstra's algorithm and A*.
+     *
+     * @param key The key to queue or update.
+     * @param priority The candidate priority.
+     * @return True if the key was queued or its priority lowered, false if the existing priority was kept.
+     */
+    bool pushOrDecrease(const int key, const P &priority) {
+        if (!checkKey(key)) return false;
+        const int index = positions[key];
+        if (index == -1) {
+            heap.push_back({priority, key});
+            siftUp(heap.getSize() - 1);
+            return true;
+        }
+        if (!(priority < heap[index].priority)) return false;
+        heap[index].priority = priority;
+        siftUp(index);
+        return true;
+    }
+
+    /**
+     * Changes the priority of a queued key in either direction, e.g. when a signal's congestion rises or falls.
+     *
+     * @param key The queued key.
+     * @param priority The new priority.
+     */
+    void update(const int key, const P &priority) {
+        if (!checkKey(key)) return;
+        if (positions[key] == -1) {
+            cout << "Error: Key not in heap." << endl;
+            return;
+        }
+        const int index = positions[key];
+        const bool lower = priority < heap[index].priority;
+        heap[index].priority = priority;
+        if (lower) {
+            siftUp(index);
+        } else {
+            siftDown(index);
+        }
+    }
+
+    /**
+     * Removes and returns the key with the smallest priority.
+     *
+     * @return The key with the smallest priority.
+     * @throws If the heap is empty, the program will exit with a status of 1.
+     */
+    int extractMin() {
+        if (heap.isEmpty()) {
+            cout << "Heap is empty!" << endl;
+            exit(1);
+        }
+
+        const int minKey = heap[0].key;
+        positions[minKey] = -1;
+        const Entry last = heap.pop();
+        if (!heap.isEmpty()) {
+            place(0, last);
+            siftDown(0);
+        }
+        return minKey;
+    }
+
+    /**
+     * Removes a queued key regardless of its priority.
+     *
+     * @param key The key to remove. Keys that are not queued are ignored.
+     */
+    void remove(const int key) {
+        if (!checkKey(key) || positions[key] == -1) return;
+
+        const int index = positions[key];
+        positions[key] = -1;
+        const Entry last = heap.pop();
+        if (index < heap.getSize()) {
+            place(index, last);
+            siftUp(index);
+            siftDown(positions[last.key]);
+        }
+    }
+
+    /**
+     * Returns the key with the smallest priority without removing it.
+     *
+     * @return The key with the smallest priority.
+     * @throws If the heap is empty, the program will exit with a status of 1.
+     */
+    int getMin() const {
+        if (heap.isEmpty()) {
+            cout << "Heap is empty!" << endl;
+            exit(1);
+        }
+        return heap[0].key;
+    }
+
+    /**
+     * Checks whether a key is currently queued.
+     *
+     * @param key The key to check.
+     * @return True if the key is in the heap, false otherwise.
+     */
+    bool contains(const int key) const {
+        return key >= 0 && key < positions.getSize() && positions[key] != -1;
+    }
+
+    /**
+     * Returns the priority of a queued key.
+     *
+     * @param key The queued key. Must be in the heap.
+     * @return The current priority of the key.
+     */
+    const P &getPriority(const int key) const {
+        return heap[positions[key]].priority;
+    }
+
+    /**
+     * Removes every queued key. Costs time proportional to the number of keys still queued,
+     * not to the capacity, so it is cheap to call between searches.
+     */
+    void clear() {
+        for (const Entry &entry : heap) {
+            positions[entry.key] = -1;
+        }
+        heap.clear();
+    }
+
+    /**
+     * Checks if the heap is empty.
+     * @return True if no key is queued, false otherwise.
+     */
+    bool isEmpty() const {
+        return heap.isEmpty();
+    }
+
+    /**
+     * Returns the number of queued keys.
+     * @return The number of keys in the heap.
+     */
+    int size() const {
+        return heap.getSize();
+    }
+};
@@ -0,0 +1,166 @@
+#include <iostream>
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <string_view>
+using namespace std;
+
+/**
+ * Interns intersection names into dense vertex indices.
+ *
+ * The first distinct name seen gets index 0, the next index 1, and so on, so the indices can address
+ * the graph's adjacency lists directly. Names are looked up through an open-addressing hash table of
+ * indices, which keeps interning O(1) on average for networks with millions of intersections.
+ */
+class IntersectionIndex {
+    /**
+     * Marks an unused slot in the lookup table.
+     */
+    static constexpr int EMPTY_SLOT = -1;
+
+    /**
+     * The name of every interned intersection, indexed by its vertex index.
+     */
+    Vector<string> names;
+    /**
+     * The hash of every interned name, kept so the table can be rebuilt without rehashing strings.
+     */
+    Vector<unsigned long long> hashes;
+    /**
+     * The lookup table. Each slot holds the index of an interned name or EMPTY_SLOT.
+     */
+    Vector<int> slots;
+    /**
+     * The lookup table capacity minus one, used to reduce hashes to slot indices.
+     */
+    int mask;
+
+    /**
+     * Computes the 64-bit FNV-1a hash of a name.
+     *
+     * @param name The name to hash.
+     * @return The hash value.
+     */
+    static unsigned long long hashName(const string_view name) {
+        unsigned long long hash = 14695981039346656037ULL;
+        for (const char c : name) {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= 1099511628211ULL;
+        }
+        return hash;
+    }
+
+    /**
+     * Finds the slot holding a name, or the empty slot where it would be inserted.
+     *
+     * @param name The name to look for.
+     * @param hash The hash of the name.
+     * @return The slot index.
+     */
+    int findSlot(const string_view name, const unsigned long long hash) const {
+        int slot = static_cast<int>(hash & mask);
+        while (slots[slot] != EMPTY_SLOT) {
+            const int id = slots[slot];
+            if (hashes[id] == hash && names[id] == name) break;
+            slot = (slot + 1) & mask;
+        }
+        return slot;
+    }
+
+    /**
+     * Rebuilds the lookup table with the given number of slots and reinserts every interned index.
+     *
+     * @param capacity The new number of slots. Must be a power of two larger than the number of names.
+     */
+    void rebuild(const int capacity) {
+        slots = Vector<int>(capacity, EMPTY_SLOT);
+        mask = slots.getSize() - 1;
+        for (int id = 0; id < names.getSize(); id++) {
+            int slot = static_cast<int>(hashes[id] & mask);
+            while (slots[slot] != EMPTY_SLOT) {
+                slot = (slot + 1) & mask;
+            }
+            slots[slot] = id;
+        }
+    }
+
+public:
+    /**
+     * Constructs an empty index with a small initial lookup table.
+     */
+    IntersectionIndex() : slots(64, EMPTY_SLOT), mask(63) {}
+
+    /**
+     * Makes room for the given total number of names, so interning that many does not grow the lookup table.
+     *
+     * @param count The number of names expected.
+     */
+    void reserve(const int count) {
+        names.reserve(count);
+        hashes.reserve(count);
+        int capacity = slots.getSize();
+        while (count * 2 > capacity) {
+            capacity *= 2;
+        }
+        if (capacity > slots.getSize()) {
+            rebuild(capacity);
+        }
+    }
+
+    /**
+     * Returns the index of a name, assigning the next free index if the name has not been seen before.
+     * The name is only copied when it is new, so interning a field straight out of a CsvReader row does not allocate
+     * for names that are already known.
+     *
+     * @param name The intersection name.
+     * @return The dense vertex index of the intersection.
+     */
+    int intern(const string_view name) {
+        const unsigned long long hash = hashName(name);
+        int slot = findSlot(name, hash);
+        if (slots[slot] != EMPTY_SLOT) {
+            return slots[slot];
+        }
+
+        const int id = names.getSize();
+        names.emplace_back(name);
+        hashes.push_back(hash);
+
+        // Keep the table at most half full so probe runs stay short
+        if (names.getSize() * 2 > slots.getSize()) {
+            rebuild(slots.getSize() * 2);
+        } else {
+            slots[slot] = id;
+        }
+        return id;
+    }
+
+    /**
+     * Looks up the index of a name without interning it.
+     *
+     * @param name The intersection name.
+     * @return The vertex index of the intersection, or -1 if the name has not been interned.
+     */
+    int find(const string_view name) const {
+        const int slot = findSlot(name, hashName(name));
+        return slots[slot];
+    }
+
+    /**
+     * Returns the name of an interned intersection.
+     *
+     * @param id The vertex index of the intersection. Must be in the range [0, getSize()).
+     * @return The name the index was assigned to.
+     */
+    const string &getName(const int id) const {
+        return names[id];
+    }
+
+    /**
+     * Returns the number of interned intersections.
+     * @return The number of distinct names seen so far.
+     */
+    int getSize() const {
+        return names.getSize();
+    }
+};
@@ -2,6 +2,8 @@
 #include <string>
 #include <fstream>
 #include <sstream>
+#include <cstddef>
+#include <iterator>
 using namespace std;
 
 /**
@@ -34,9 +36,88 @@ public:
     Node(const int d, const float w) : data(d), weight(w), next(nullptr) {}
 };
 
+template<typename NodeType>
+/**
+ * A forward iterator that walks the nodes of a LinkedList from the head.
+ * Dereferencing yields the node itself, so both its data and its weight are available,
+ * e.g. `for (const Node &edge : list)`.
+ *
+ * @tparam NodeType Node for a walk that may modify the nodes, const Node for a read-only walk.
+ */
+class ListIterator {
+    /**
+     * The node the iterator points to, or nullptr once it has passed the last node.
+     */
+    NodeType *current;
+
+public:
+    typedef forward_iterator_tag iterator_category;
+    typedef Node value_type;
+    typedef ptrdiff_t difference_type;
+    typedef NodeType *pointer;
+    typedef NodeType &reference;
+
+    /**
+     * Constructs an iterator pointing to the given node.
+     *
+     * @param node The node to start at, or nullptr for the end iterator.
+     */
+    explicit ListIterator(NodeType *node = nullptr) : current(node) {}
+
+    /**
+     * Returns the node the iterator points to.
+     * @return A reference to the current node.
+     */
+    reference operator*() const { return *current; }
+
+    /**
+     * Gives member access to the node the iterator points to.
+     * @return A pointer to the current node.
+     */
+    pointer operator->() const { return current; }
+
+    /**
+     * Advances to the next node.
+     * @return A reference to this iterator.
+     */
+    ListIterator &operator++() {
+        current = current->next;
+        return *this;
+    }
+
+    /**
+     * Advances to the next node, returning the iterator's previous position.
+     * @return An iterator to the node before the advance.
+     */
+    ListIterator operator++(int) {
+        ListIterator previous = *this;
+        current = current->next;
+        return previous;
+    }
+
+    /**
+     * Checks whether two iterators point to the same node.
+     *
+     * @param other The iterator to compare with.
+     * @return True if both point to the same node, or both are end iterators.
+     */
+    bool operator==(const ListIterator &other) const { return current == other.current; }
+
+    /**
+     * Checks whether two iterators point to different nodes.
+     *
+     * @param other The iterator to compare with.
+     * @return True if the iterators point to different nodes.
+     */
+    bool operator!=(const ListIterator &other) const { return current != other.current; }
+};
+
 /**
  * Represents a singly linked list structure that supports basic operations like insertion,
  * deletion, and traversal. It manages nodes containing integer data and float weight.
+ *
+ * The list keeps a tail pointer and its length, so appending is O(1), and a node whose predecessor
+ * the caller already knows (e.g. from an edge index) can be removed in O(1) with removeAfter.
  */
 class LinkedList {
     /**
@@ -44,29 +125,120 @@ class LinkedList {
      * Initially set to nullptr, it serves as the entry point to the list.
      */
     Node *head;
+    /**
+     * A pointer to the last node in the list, or nullptr if the list is empty.
+     */
+    Node *tail;
+    /**
+     * The number of nodes in the list.
+     */
+    int count;
+    /**
+     * The pool the nodes are allocated from, or nullptr if every node is allocated with new on its own.
+     * Several lists may share one pool, e.g. all adjacency lists of a Graph.
+     */
+    NodePool<Node> *pool;
+
+    /**
+     * Allocates a node from the pool, or with new if the list has no pool.
+     *
+     * @param value The integer value to be stored in the new node.
+     * @param weight The float weight to be stored in the new node.
+     * @return The new node, not yet linked into the list.
+     */
+    Node *createNode(const int value, const float weight) {
+        return pool ? pool->create(value, weight) : new Node(value, weight);
+    }
+
+    /**
+     * Frees a node that has already been unlinked from the list.
+     *
+     * @param node The node to free.
+     */
+    void freeNode(Node *node) {
+        if (pool) {
+            pool->destroy(node);
+        } else {
+            delete node;
+        }
+    }
+
+    /**
+     * Appends a copy of every node of another list, in order, to this list, which must be empty.
+     *
+     * @param other The list to copy the nodes from.
+     */
+    void copyNodes(const LinkedList &other) {
+        Node **link = &head;
+        for (const Node &node : other) {
+            tail = createNode(node.data, node.weight);
+            *link = tail;
+            link = &tail->next;
+        }
+        count = other.count;
+    }
+
+    /**
+     * Links a node into the list directly after the given node.
+     *
+     * @param position The node to insert after, or nullptr to insert at the beginning.
+     * @param node The unlinked node to insert.
+     */
+    void linkAfter(Node *position, Node *node) {
+        if (position) {
+            node->next = position->next;
+            position->next = node;
+        } else {
+            node->next = head;
+            head = node;
+        }
+        if (position == tail) {
+            tail = node;
+        }
+        count++;
+    }
+
+    /**
+     * Returns the node at the given zero-based position.
+     *
+     * @param position The position of the node.
+     * @return The node, or nullptr if the list is shorter.
+     */
+    Node *nodeAt(const int position) const {
+        Node *temp = head;
+        for (int i = 0; i < position && temp; ++i) {
+            temp = temp->next;
+        }
+        return temp;
+    }
 
     /**
      * @brief Constructs an empty LinkedList.
      *
      * Initializes the head of the list to nullptr, indicating that the list is initially empty.
      *
+     * @param nodePool The pool to allocate nodes from, or nullptr to allocate each node with new.
      * @return An instance of LinkedList with no nodes.
      */
 public:
-    LinkedList() : head(nullptr) {}
+    explicit LinkedList(NodePool<Node> *nodePool = nullptr) : head(nullptr), tail(nullptr), count(0), pool(nodePool) {}
 
     /**
      * @brief Destructor for the LinkedList class.
      *
      * This destructor ensures that all dynamically allocated nodes in the linked list
      * are properly deleted, preventing memory leaks by calling the deleteList() method.
+     * Nodes taken from a pool are left to the pool's owner, which frees all of them at once
+     * when it releases the pool.
      */
     ~LinkedList() {
-        deleteList();
+        if (!pool) {
+            deleteList();
+        }
     }
 
     /**
-     * Deletes all nodes in the linked list, freeing their memory.
+     * Deletes all nodes in the linked list, freeing their memory (or returning it to the pool).
      * Sets the head pointer to nullptr after deletion to indicate
      * that the list is empty.
      */
@@ -74,39 +246,62 @@ public:
         Node *current = head;
         while (current) {
             Node *next = current->next;
-            delete current;
+            freeNode(current);
             current = next;
         }
-        head = nullptr;
+        abandonNodes();
     }
 
+    /**
+     * Forgets every node without freeing them, leaving the list empty in O(1).
+     * Only valid for pooled lists whose pool is about to be released, which frees the nodes in bulk.
+     */
+    void abandonNodes() {
+        head = nullptr;
+        tail = nullptr;
+        count = 0;
+    }
 
     /**
      * @brief Copy constructor for the LinkedList class.
      *
      * Creates a deep copy of the provided linked list, ensuring that each node in the
      * original list is duplicated and placed in the same order in the new list.
+     * The copy allocates its nodes from the same pool as the original.
      *
      * @param other The LinkedList instance to copy.
      */
-    LinkedList(const LinkedList &other) : head(nullptr) {
-        if (other.head) {
-            head = new Node(other.head->data, other.head->weight);
-            Node *current = head;
-            Node *otherCurrent = other.head->next;
-
-            while (otherCurrent) {
-                current->next = new Node(otherCurrent->data, otherCurrent->weight);
-                current = current->next;
-                otherCurrent = otherCurrent->next;
-            }
-        }
+    LinkedList(const LinkedList &other) : head(nullptr), tail(nullptr), count(0), pool(other.pool) {
+        copyNodes(other);
+    }
+
+    /**
+     * Creates a deep copy of the provided linked list whose nodes are allocated from the given pool.
+     *
+     * @param other The LinkedList instance to copy.
+     * @param nodePool The pool to allocate the copied nodes from, or nullptr to allocate each node with new.
+     */
+    LinkedList(const LinkedList &other, NodePool<Node> *nodePool) : head(nullptr), tail(nullptr), count(0),
+                                                                     pool(nodePool) {
+        copyNodes(other);
+    }
+
+    /**
+     * @brief Move constructor for the LinkedList class.
+     *
+     * Takes over the nodes of the given list, and the pool they came from, without copying them, leaving it empty.
+     *
+     * @param other The LinkedList instance to move from.
+     */
+    LinkedList(LinkedList &&other) noexcept : head(other.head), tail(other.tail), count(other.count), pool(other.pool) {
+        other.abandonNodes();
     }
 
     /**
      * @brief Assignment operator overload for the LinkedList class.
      *
-     * Assigns a deep copy of the given linked list to this instance.
+     * Assigns a deep copy of the given linked list to this instance. The copied nodes are
+     * allocated from this list's own pool.
      *
      * @param other The LinkedList instance to assign.
      * @return A reference to this LinkedList instance with the copied content.
@@ -114,18 +309,27 @@ public:
     LinkedList &operator=(const LinkedList &other) {
         if (this != &other) {
             deleteList();
+            copyNodes(other);
+        }
+        return *this;
+    }
 
-            if (other.head) {
-                head = new Node(other.head->data, other.head->weight);
-                Node *current = head;
-                Node *otherCurrent = other.head->next;
-
-                while (otherCurrent) {
-                    current->next = new Node(otherCurrent->data, otherCurrent->weight);
-                    current = current->next;
-                    otherCurrent = otherCurrent->next;
-                }
-            }
+    /**
+     * @brief Move assignment operator for the LinkedList class.
+     *
+     * Frees the current nodes and takes over the nodes of the given list, and the pool they came from, leaving it empty.
+     *
+     * @param other The LinkedList instance to move from.
+     * @return A reference to this LinkedList instance.
+     */
+    LinkedList &operator=(LinkedList &&other) noexcept {
+        if (this != &other) {
+            deleteList();
+            head = other.head;
+            tail = other.tail;
+            count = other.count;
+            pool = other.pool;
+            other.abandonNodes();
         }
         return *this;
     }
@@ -137,31 +341,20 @@ public:
      * @param weight The float weight to be stored in the new node.
      */
     void insertAtBeginning(const int value, const float weight) {
-        auto newNode = new Node(value, weight);
-        newNode->next = head;
-        head = newNode;
+        linkAfter(nullptr, createNode(value, weight));
     }
 
     /**
-     * Inserts a new node with the specified value and weight at the end of the linked list.
+     * Inserts a new node with the specified value and weight at the end of the linked list in O(1).
      *
      * @param value The integer value to be stored in the new node.
      * @param weight The float weight to be stored in the new node.
+     * @return The new node, which stays valid until it is deleted.
      */
-    void insertAtEnd(const int value, const float weight) {
-        auto newNode = new Node(value, weight);
-
-        if (!head) {
-            head = newNode;
-            return;
-        }
-
-        Node *temp = head;
-        while (temp->next) {
-            temp = temp->next;
-        }
-
-        temp->next = newNode;
+    Node *insertAtEnd(const int value, const float weight) {
+        Node *newNode = createNode(value, weight);
+        linkAfter(tail, newNode);
+        return newNode;
     }
 
     /**
@@ -182,21 +375,33 @@ public:
             return;
         }
 
-        Node *newNode = new Node(value, weight);
-
-        Node *temp = head;
-        for (int i = 0; i < position - 1 && temp; ++i) {
-            temp = temp->next;
-        }
-
+        Node *temp = nodeAt(position - 1);
         if (!temp) {
             cout << "Error: Position out of range." << endl;
-            delete newNode;
             return;
         }
 
-        newNode->next = temp->next;
-        temp->next = newNode;
+        linkAfter(temp, createNode(value, weight));
+    }
+
+    /**
+     * Unlinks and frees the node that follows the given node, in O(1).
+     *
+     * @param position The predecessor of the node to remove, or nullptr to remove the head.
+     *                 The node to remove must exist.
+     */
+    void removeAfter(Node *position) {
+        Node *nodeToDelete = position ? position->next : head;
+        if (position) {
+            position->next = nodeToDelete->next;
+        } else {
+            head = nodeToDelete->next;
+        }
+        if (nodeToDelete == tail) {
+            tail = position;
+        }
+        count--;
+        freeNode(nodeToDelete);
     }
 
     /**
@@ -209,9 +414,7 @@ public:
             return;
         }
 
-        Node *temp = head;
-        head = head->next;
-        delete temp;
+        removeAfter(nullptr);
     }
 
     /**
@@ -225,19 +428,7 @@ public:
             return;
         }
 
-        if (!head->next) {
-            delete head;
-            head = nullptr;
-            return;
-        }
-
-        Node *temp = head;
-        while (temp->next->next) {
-            temp = temp->next;
-        }
-
-        delete temp->next;
-        temp->next = nullptr;
+        removeAfter(count > 1 ? nodeAt(count - 2) : nullptr);
     }
 
     /**
@@ -256,18 +447,12 @@ public:
             return;
         }
 
-        Node *temp = head;
-        for (int i = 0; i < position - 1 && temp; ++i) {
-            temp = temp->next;
-        }
-
+        Node *temp = nodeAt(position - 1);
         if (!temp || !temp->next) {
             cout << "Error: Position out of range." << endl;
             return;
         }
-        Node *nodeToDelete = temp->next;
-        temp->next = temp->next->next;
-        delete nodeToDelete;
+        removeAfter(temp);
     }
 
     /**
@@ -282,6 +467,71 @@ public:
         return head;
     }
 
+    /**
+     * Retrieves the last node of the linked list.
+     *
+     * @return A pointer to the tail node, or nullptr if the list is empty.
+     */
+    Node *getTail() const {
+        return tail;
+    }
+
+    /**
+     * Returns the number of nodes in the list.
+     * @return The length of the list.
+     */
+    int getSize() const {
+        return count;
+    }
+
+    /**
+     * Finds the first node holding the given value, together with its predecessor.
+     *
+     * @param value The integer value to look for.
+     * @param previous Set to the predecessor of the returned node, or nullptr if it is the head.
+     *                 On input, the node after which to start searching, or nullptr to start at the head.
+     * @return The first matching node after the starting point, or nullptr if there is none.
+     */
+    Node *findNode(const int value, Node *&previous) const {
+        Node *temp = previous ? previous->next : head;
+        while (temp && temp->data != value) {
+            previous = temp;
+            temp = temp->next;
+        }
+        return temp;
+    }
+
+    /**
+     * Iterator types for walking the nodes from head to tail.
+     * Deleting a node invalidates iterators that point to it; other iterators stay valid.
+     */
+    typedef ListIterator<Node> iterator;
+    typedef ListIterator<const Node> const_iterator;
+
+    /**
+     * Returns an iterator to the head node.
+     * @return An iterator to the first node, equal to end() if the list is empty.
+     */
+    iterator begin() { return iterator(head); }
+
+    /**
+     * Returns the iterator that follows the last node.
+     * @return The end iterator.
+     */
+    iterator end() { return iterator(); }
+
+    /**
+     * Returns a read-only iterator to the head node.
+     * @return A read-only iterator to the first node, equal to end() if the list is empty.
+     */
+    const_iterator begin() const { return const_iterator(head); }
+
+    /**
+     * Returns the read-only iterator that follows the last node.
+     * @return The read-only end iterator.
+     */
+    const_iterator end() const { return const_iterator(); }
+
     /**
      * Deletes the first occurrence of a node with the specified value from the linked list.
      * If the list is empty or the value is not found, an error message is displayed.
@@ -294,24 +544,13 @@ public:
             return;
         }
 
-        if (head->data == value) {
-            deleteFromBeginning();
-            return;
-        }
-
-        Node *temp = head;
-        while (temp->next && temp->next->data != value) {
-            temp = temp->next;
-        }
-
-        if (!temp->next) {
+        Node *previous = nullptr;
+        if (!findNode(value, previous)) {
             cout << "Error: Value not found." << endl;
             return;
         }
 
-        Node *nodeToDelete = temp->next;
-        temp->next = temp->next->next;
-        delete nodeToDelete;
+        removeAfter(previous);
     }
 
     /**
@@ -337,10 +576,8 @@ public:
             return;
         }
 
-        Node *temp = head;
-        while (temp) {
-            cout << "(" << temp->data << ", " << temp->weight << ") -> ";
-            temp = temp->next;
+        for (const Node &node : *this) {
+            cout << "(" << node.data << ", " << node.weight << ") -> ";
         }
         cout << "NULL" << endl;
     }
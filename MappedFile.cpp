@@ -0,0 +1,148 @@
+#include <iostream>
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <cstddef>
+
+#ifdef _WIN32
+#include <sys/stat.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+/**
+ * A read-only view of a whole file's contents.
+ *
+ * On POSIX systems the file is memory-mapped, so opening it costs no copying and its pages are only read from
+ * disk (or the page cache) when they are touched. Elsewhere the file is read into a buffer once, which gives
+ * the same interface at the cost of one copy.
+ */
+class MappedFile {
+    /**
+     * The first byte of the file, or nullptr if no file is open or the file is empty.
+     */
+    const char *data;
+    /**
+     * The size of the file in bytes.
+     */
+    size_t size;
+#ifdef _WIN32
+    /**
+     * The file contents, read into memory because the file is not mapped on this platform.
+     */
+    Vector<char> buffer;
+#endif
+
+public:
+    /**
+     * Constructs a MappedFile with no file open.
+     */
+    MappedFile() : data(nullptr), size(0) {}
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    /**
+     * Destructor. Unmaps the file, if one is open.
+     */
+    ~MappedFile() {
+        close();
+    }
+
+    /**
+     * Maps a file into memory, closing the previously open file first.
+     *
+     * @param fileName The path of the file to open.
+     * @return True if the file was opened (an empty file counts), false if it does not exist or cannot be read.
+     */
+    bool open(const string &fileName) {
+        close();
+#ifdef _WIN32
+        ifstream file(fileName, ios::binary | ios::ate);
+        if (!file.is_open()) return false;
+        const streamoff length = file.tellg();
+        file.seekg(0);
+        buffer = Vector<char>(static_cast<int>(length));
+        if (length > 0 && !file.read(buffer.begin(), length)) {
+            buffer = Vector<char>();
+            return false;
+        }
+        data = length > 0 ? buffer.begin() : nullptr;
+        size = static_cast<size_t>(length);
+        return true;
+#else
+        const int fd = ::open(fileName.c_str(), O_RDONLY);
+        if (fd < 0) return false;
+
+        struct stat info;
+        if (fstat(fd, &info) != 0) {
+            ::close(fd);
+            return false;
+        }
+        if (info.st_size > 0) {
+            void *mapping = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapping == MAP_FAILED) {
+                ::close(fd);
+                return false;
+            }
+            data = static_cast<const char *>(mapping);
+            size = static_cast<size_t>(info.st_size);
+        }
+        // The mapping stays valid after the descriptor is closed
+        ::close(fd);
+        return true;
+#endif
+    }
+
+    /**
+     * Unmaps the open file. Every pointer into its contents becomes invalid.
+     */
+    void close() {
+#ifdef _WIN32
+        buffer = Vector<char>();
+#else
+        if (data) {
+            munmap(const_cast<char *>(data), size);
+        }
+#endif
+        data = nullptr;
+        size = 0;
+    }
+
+    /**
+     * Returns the contents of the open file.
+     * @return A pointer to the first byte, or nullptr if no file is open or the file is empty.
+     */
+    const char *getData() const {
+        return data;
+    }
+
+    /**
+     * Returns the size of the open file.
+     * @return The number of bytes in the file, or 0 if no file is open.
+     */
+    size_t getSize() const {
+        return size;
+    }
+};
+
+/**
+ * Reads the size and last modification time of a file, used to tell whether a file derived from it is stale.
+ *
+ * @param fileName The path of the file.
+ * @param fileSize Set to the size of the file in bytes.
+ * @param modified Set to the last modification time in seconds since the epoch.
+ * @return True if the file exists, false otherwise (the outputs are left unchanged).
+ */
+bool getFileStamp(const string &fileName, long long &fileSize, long long &modified) {
+    struct stat info;
+    if (stat(fileName.c_str(), &info) != 0) return false;
+    fileSize = static_cast<long long>(info.st_size);
+    modified = static_cast<long long>(info.st_mtime);
+    return true;
+}
@@ -2,122 +2,123 @@
 #include <string>
 #include <fstream>
 #include <sstream>
+#include <functional>
+#include <utility>
 
 using namespace std;
 
-template<typename T>
+template<typename T, typename Compare = less<T>>
 /**
- * Represents a node in a heap data structure.
+ * Represents a generic MinHeap data structure.
+ * Provides methods to insert elements, extract the minimum element,
+ * and perform heap operations such as heapify up and heapify down.
  *
- * @tparam T Type of the value contained in the node.
+ * The heap is an implicit binary tree stored in a contiguous array: the children of the element at
+ * index i live at 2i + 1 and 2i + 2. Insert and extractMin are O(log n) and never allocate per element.
+ *
+ * @tparam T Type of the stored values.
+ * @tparam Compare Strict weak ordering; compare(a, b) is true when a belongs closer to the top than b.
  */
-class HeapNode {
-    /**
-     * Represents the value stored in a node of the heap.
-     * It is of a generic type `T` and can hold any comparable value.
-     */
-public:
-    T value;
-    /**
-     * @brief Pointer to the left child node.
-     * @details Represents the left child in the binary heap structure, used for navigation and manipulation within the heap.
-     */
-    HeapNode *left;
+class MinHeap {
     /**
-     * Pointer to the right child node in a binary heap structure.
-     * Used to represent and navigate the right subtree of the current node.
+     * The elements of the heap in level order. The minimum is at index 0.
      */
-    HeapNode *right;
+    Vector<T> elements;
     /**
-     * Pointer to the parent node in the heap.
-     * Used to navigate from a child node to its parent.
+     * The ordering used to decide which element is smaller.
      */
-    HeapNode *parent;
+    Compare compare;
 
     /**
-     * Constructs a new HeapNode with the given value and initializes all pointers to nullptr.
+     * Restores the min-heap property by moving the element at the given index down the tree.
+     * Compares the element with its children and swaps it with the smallest until neither child is smaller.
      *
-     * @param val The value to be stored in the newly created heap node.
-     * @return An instance of HeapNode with specified value and null child and parent pointers.
-     */
-    explicit HeapNode(T val) : value(val), left(nullptr), right(nullptr), parent(nullptr) {
+     * @param index The index of the element that needs to be heapified down.
+     */
+    void heapifyDown(int index) {
+        const int count = elements.getSize();
+        T value = std::move(elements[index]);
+        while (true) {
+            int child = 2 * index + 1;
+            if (child >= count) break;
+            if (child + 1 < count && compare(elements[child + 1], elements[child])) {
+                child++;
+            }
+            if (!compare(elements[child], value)) break;
+            elements[index] = std::move(elements[child]);
+            index = child;
+        }
+        elements[index] = std::move(value);
     }
-};
 
-template<typename T>
-/**
- * Represents a generic MinHeap data structure.
- * Provides methods to insert elements, extract the minimum element,
- * and perform heap operations such as heapify up and heapify down.
- */
-class MinHeap {
-    /**
-     * Pointer to the root node of the MinHeap.
-     * Represents the smallest element in the heap.
-     * Used as the starting point for all heap operations.
-     */
-    HeapNode<T> *root;
     /**
-     * Represents the total number of nodes currently present in the MinHeap.
-     * Used to manage heap operations such as insertions and removals.
-     */
-    int nodeCount = 0;
+     * Restores the heap property by moving the element at the given index up the tree as long as it is
+     * smaller than its parent.
+     *
+     * @param index The index of the element to be adjusted upwards.
+     */
+    void heapifyUp(int index) {
+        T value = std::move(elements[index]);
+        while (index > 0) {
+            int parentIdx = (index - 1) / 2;
+            if (!compare(value, elements[parentIdx])) break;
+            elements[index] = std::move(elements[parentIdx]);
+            index = parentIdx;
+        }
+        elements[index] = std::move(value);
+    }
 
     /**
-     * Swaps the values of two heap nodes.
-     *
-     * @param a Pointer to the first heap node to be swapped.
-     * @param b Pointer to the second heap node to be swapped.
+     * Arranges the stored elements into a heap bottom-up in O(n).
      */
-    void swap(HeapNode<T> *a, HeapNode<T> *b) {
-        T temp = a->value;
-        a->value = b->value;
-        b->value = temp;
+    void buildHeap() {
+        for (int i = elements.getSize() / 2 - 1; i >= 0; i--) {
+            heapifyDown(i);
+        }
     }
 
     /**
-     * Restores the min-heap property by moving the specified node down the tree.
-     * Compares the node with its children and swaps it with the smallest if necessary.
-     * Continues the process recursively until the node is in the correct position.
+     * Constructs an empty MinHeap.
      *
-     * @param node A pointer to the heap node that needs to be heapified down.
+     * @param comparator The ordering used to compare elements.
      */
-    void heapifyDown(HeapNode<T> *node) {
-        if (!node) return;
-        HeapNode<T> *smallest = node;
-
-        if (node->left && node->left->value < smallest->value) {
-            smallest = node->left;
-        }
-
-        if (node->right && node->right->value < smallest->value) {
-            smallest = node->right;
-        }
+public:
+    explicit MinHeap(const Compare &comparator = Compare()) : compare(comparator) {}
 
-        if (smallest != node) {
-            swap(node, smallest);
-            heapifyDown(smallest);
+    /**
+     * Constructs a MinHeap holding a copy of the elements in [first, last), heapified in O(n).
+     *
+     * @param first Pointer to the first element to copy.
+     * @param last Pointer one past the last element to copy.
+     * @param comparator The ordering used to compare elements.
+     */
+    MinHeap(const T *first, const T *last, const Compare &comparator = Compare()) : compare(comparator) {
+        elements.reserve(static_cast<int>(last - first));
+        for (const T *it = first; it != last; ++it) {
+            elements.push_back(*it);
         }
+        buildHeap();
     }
 
     /**
-     * Restores the heap property by moving a node up the tree as long as it is smaller than its parent.
+     * Constructs a MinHeap holding a copy of every element of a vector, heapified in O(n).
      *
-     * @param node The heap node to be adjusted upwards.
+     * @param values The elements to store.
+     * @param comparator The ordering used to compare elements.
      */
-    void heapifyUp(HeapNode<T> *node) {
-        if (node->parent && node->value < node->parent->value) {
-            swap(node, node->parent);
-            heapifyUp(node->parent);
-        }
+    explicit MinHeap(const Vector<T> &values, const Compare &comparator = Compare())
+        : elements(values), compare(comparator) {
+        buildHeap();
     }
 
     /**
-     * Constructs an empty MinHeap.
-     * @return A new MinHeap object with an initialized empty root.
+     * Reserves storage for at least the given number of elements so later inserts do not reallocate.
+     *
+     * @param capacity The number of elements to make room for.
      */
-public:
-    MinHeap() : root(nullptr) {}
+    void reserve(const int capacity) {
+        elements.reserve(capacity);
+    }
 
     /**
      * Inserts a new element into the heap while maintaining the heap property.
@@ -125,145 +126,93 @@ public:
      * @param value The value to be inserted into the min-heap.
      */
     void insert(const T &value) {
-        auto *newNode = new HeapNode<T>(value);
-
-        if (!root) {
-            root = newNode;
-        } else {
-            Queue<HeapNode<T> *> nodeQueue;
-            nodeQueue.enqueue(root);
-            while (!nodeQueue.isEmpty()) {
-                HeapNode<T> *current = nodeQueue.front();
-                nodeQueue.dequeue();
-
-                if (!current->left) {
-                    current->left = newNode;
-                    newNode->parent = current;
-                    break;
-                }
-
-                if (!current->right) {
-                    current->right = newNode;
-                    newNode->parent = current;
-                    break;
-                }
-
-                nodeQueue.enqueue(current->left);
-                nodeQueue.enqueue(current->right);
-            }
-        }
+        elements.push_back(value);
+        heapifyUp(elements.getSize() - 1);
+    }
 
-        heapifyUp(newNode);
-        nodeCount++;
+    /**
+     * Moves a new element into the heap while maintaining the heap property.
+     *
+     * @param value The value to be moved into the min-heap.
+     */
+    void insert(T &&value) {
+        elements.push_back(std::move(value));
+        heapifyUp(elements.getSize() - 1);
     }
 
     /**
      * Extracts and returns the minimum element from the heap.
-     * Removes the root of the heap and restructures the heap to maintain the min-heap property.
+     * Moves the last element to the root and heapifies it down to maintain the min-heap property.
      *
      * @return The minimum element in the heap.
-     * @throws std::runtime_error if the heap is empty.
+     * @throws If the heap is empty, the program will exit with a status of 1.
      */
     T extractMin() {
-        if (!root) {
+        if (elements.isEmpty()) {
             cout << "Heap is empty!" << endl;
             exit(1);
         }
 
-        T minValue = root->value;
-        if (nodeCount == 1) {
-            delete root;
-            root = nullptr;
-            nodeCount--;
-            return minValue;
-        }
-
-        HeapNode<T> *lastNode = getLastNode();
-        root->value = lastNode->value;
-        if (lastNode->parent->left == lastNode) {
-            lastNode->parent->left = nullptr;
-        } else {
-            lastNode->parent->right = nullptr;
+        T minValue = std::move(elements[0]);
+        T lastValue = elements.pop();
+        if (!elements.isEmpty()) {
+            elements[0] = std::move(lastValue);
+            heapifyDown(0);
         }
 
-        delete lastNode;
-        heapifyDown(root);
-        nodeCount--;
-
         return minValue;
     }
 
-    /**
-     * Retrieves the last node in a binary heap using level order traversal.
-     *
-     * @return A pointer to the last node in the heap, or nullptr if the heap is empty.
-     */
-    HeapNode<T> *getLastNode() {
-        Queue<HeapNode<T> *> nodeQueue;
-        nodeQueue.enqueue(root);
-        HeapNode<T> *lastNode = nullptr;
-
-        while (!nodeQueue.isEmpty()) {
-            lastNode = nodeQueue.front();
-            nodeQueue.dequeue();
-            if (lastNode->left) nodeQueue.enqueue(lastNode->left);
-            if (lastNode->right) nodeQueue.enqueue(lastNode->right);
-        }
-
-        return lastNode;
-    }
-
     /**
      * Retrieves the minimum value from the heap without removing it.
      * @return The minimum value stored in the heap.
      * @throws If the heap is empty, the program will exit with a status of 1.
      */
-    T getMin() const {
-        if (!root) {
+    const T &getMin() const {
+        if (elements.isEmpty()) {
             cout << "Heap is empty!" << endl;
             exit(1);
         }
 
-        return root->value;
+        return elements[0];
+    }
+
+    /**
+     * Removes every element while keeping the allocated storage.
+     */
+    void clear() {
+        elements.clear();
     }
 
     /**
      * Checks if the heap is empty.
-     * @return True if the heap contains no nodes, false otherwise.
+     * @return True if the heap contains no elements, false otherwise.
      */
     bool isEmpty() const {
-        return nodeCount == 0;
+        return elements.isEmpty();
     }
 
     /**
-     * Returns the number of nodes in the MinHeap.
+     * Returns the number of elements in the MinHeap.
      *
-     * @return The total count of nodes currently present in the MinHeap.
+     * @return The total count of elements currently present in the MinHeap.
      */
     int size() const {
-        return nodeCount;
+        return elements.getSize();
     }
 
     /**
-     * Displays the values of the heap nodes in level-order traversal.
+     * Displays the values of the heap in level-order.
      * If the heap is empty, outputs an appropriate message indicating so.
-     * Uses a queue to facilitate breadth-first traversal from root to leaves.
      */
     void display() const {
-        if (!root) {
+        if (elements.isEmpty()) {
             cout << "Heap is empty!" << endl;
             return;
         }
 
-        Queue<HeapNode<T> *> nodeQueue;
-        nodeQueue.enqueue(root);
-        while (!nodeQueue.isEmpty()) {
-            HeapNode<T> *current = nodeQueue.front();
-            nodeQueue.dequeue();
-            cout << current->value << " ";
-
-            if (current->left) nodeQueue.enqueue(current->left);
-            if (current->right) nodeQueue.enqueue(current->right);
+        for (int i = 0; i < elements.getSize(); i++) {
+            cout << elements[i] << " ";
         }
 
         cout << endl;
@@ -0,0 +1,176 @@
+#include <iostream>
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <new>
+#include <type_traits>
+#include <utility>
+using namespace std;
+
+template<typename T>
+/**
+ * A slab allocator for small fixed-size objects such as linked list nodes.
+ *
+ * Objects are carved sequentially out of large slabs, so objects allocated one after another sit next to each
+ * other in memory and an allocation is a pointer bump instead of a call to operator new. Destroyed objects go on
+ * a free list and are reused by later allocations. Releasing the whole pool frees every slab at once without
+ * visiting the objects, which is why T must be trivially destructible.
+ *
+ * @tparam T Type of the pooled objects.
+ */
+class NodePool {
+    static_assert(is_trivially_destructible<T>::value, "NodePool objects are released without running destructors");
+    static_assert(sizeof(T) >= sizeof(void *), "NodePool reuses freed objects to hold the free list link");
+
+    /**
+     * The number of objects in the first slab. Later slabs double in size up to MAX_SLAB_SIZE.
+     */
+    static constexpr int MIN_SLAB_SIZE = 64;
+    /**
+     * The largest number of objects a slab grows to on its own. reserve() may create larger slabs.
+     */
+    static constexpr int MAX_SLAB_SIZE = 1 << 16;
+
+    /**
+     * The link stored inside a freed object while it waits on the free list.
+     */
+    struct FreeSlot {
+        FreeSlot *next;
+    };
+
+    /**
+     * Every slab owned by the pool, in allocation order.
+     */
+    Vector<T *> slabs;
+    /**
+     * The next unused object in the newest slab.
+     */
+    T *cursor;
+    /**
+     * One past the last object in the newest slab.
+     */
+    T *limit;
+    /**
+     * The most recently freed object, or nullptr if none is waiting to be reused.
+     */
+    FreeSlot *freeList;
+    /**
+     * The number of objects that have been created and not destroyed.
+     */
+    int live;
+    /**
+     * The total number of objects the slabs can hold.
+     */
+    long long capacity;
+
+    /**
+     * Allocates a new slab and makes it the one new objects are carved from.
+     * Any objects left unused in the previous slab stay unused until the pool is released.
+     *
+     * @param count The number of objects the slab holds.
+     */
+    void addSlab(const int count) {
+        T *slab = static_cast<T *>(::operator new(sizeof(T) * count));
+        slabs.push_back(slab);
+        cursor = slab;
+        limit = slab + count;
+        capacity += count;
+    }
+
+public:
+    /**
+     * Constructs an empty pool. No slab is allocated until the first object is created.
+     */
+    NodePool() : cursor(nullptr), limit(nullptr), freeList(nullptr), live(0), capacity(0) {}
+
+    NodePool(const NodePool &) = delete;
+    NodePool &operator=(const NodePool &) = delete;
+
+    /**
+     * Destructor. Frees every slab; objects still alive are released with them.
+     */
+    ~NodePool() {
+        release();
+    }
+
+    /**
+     * Constructs an object from the given arguments in pooled storage.
+     *
+     * @param args The arguments forwarded to T's constructor.
+     * @return A pointer to the new object, valid until it is destroyed or the pool is released.
+     */
+    template<typename... Args>
+    T *create(Args &&... args) {
+        void *slot;
+        if (freeList != nullptr) {
+            slot = freeList;
+            freeList = freeList->next;
+        } else {
+            if (cursor == limit) {
+                const long long doubled = capacity < MIN_SLAB_SIZE ? MIN_SLAB_SIZE : capacity;
+                addSlab(static_cast<int>(doubled < MAX_SLAB_SIZE ? doubled : MAX_SLAB_SIZE));
+            }
+            slot = cursor++;
+        }
+        live++;
+        return new (slot) T(std::forward<Args>(args)...);
+    }
+
+    /**
+     * Returns an object to the pool so its storage can be reused by a later create().
+     *
+     * @param object An object created by this pool. Ignored if nullptr.
+     */
+    void destroy(T *object) {
+        if (object == nullptr) return;
+        object->~T();
+        FreeSlot *slot = reinterpret_cast<FreeSlot *>(object);
+        slot->next = freeList;
+        freeList = slot;
+        live--;
+    }
+
+    /**
+     * Makes sure the next count objects can be created from a single contiguous slab, without further
+     * allocation. Used when the number of objects is known in advance, e.g. when copying a graph.
+     *
+     * @param count The number of objects about to be created.
+     */
+    void reserve(const int count) {
+        if (limit - cursor < count) {
+            addSlab(count);
+        }
+    }
+
+    /**
+     * Frees every slab at once, releasing all objects without visiting them. Costs time proportional to the
+     * number of slabs, not the number of objects. Every pointer handed out by the pool becomes invalid.
+     */
+    void release() {
+        for (T *slab : slabs) {
+            ::operator delete(slab);
+        }
+        slabs.clear();
+        cursor = nullptr;
+        limit = nullptr;
+        freeList = nullptr;
+        live = 0;
+        capacity = 0;
+    }
+
+    /**
+     * Returns the number of objects currently alive.
+     * @return The number of objects created and not yet destroyed.
+     */
+    int getLiveCount() const {
+        return live;
+    }
+
+    /**
+     * Returns the number of slabs the pool has allocated, i.e. how many times it called operator new.
+     * @return The number of slabs.
+     */
+    int getSlabCount() const {
+        return slabs.getSize();
+    }
+};
@@ -0,0 +1,60 @@
+#include <iostream>
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+using namespace std;
+
+/**
+ * Returns the number of threads parallel work is spread over: one per hardware thread.
+ *
+ * @return The number of hardware threads, or 1 if it cannot be determined.
+ */
+int workerCount() {
+    const unsigned int threads = thread::hardware_concurrency();
+    return threads == 0 ? 1 : static_cast<int>(threads);
+}
+
+/**
+ * Runs a loop over [0, count) on every core.
+ *
+ * The range is cut into batches of batchSize indices that the threads claim one at a time from a shared
+ * counter, so threads that draw cheap batches simply take more of them. The calling thread works too and the
+ * call returns once every batch is done. With a single core, or a single batch, the body runs on the calling
+ * thread without starting any thread.
+ *
+ * @param count The number of indices.
+ * @param batchSize The number of consecutive indices handed out at a time.
+ * @param body Called as body(first, last) for each batch [first, last). Calls may run concurrently.
+ */
+template<typename Body>
+void parallelFor(const int count, const int batchSize, Body body) {
+    if (count <= 0) return;
+    const int batches = (count - 1) / batchSize + 1;
+    const int threads = min(workerCount(), batches);
+    if (threads == 1) {
+        body(0, count);
+        return;
+    }
+
+    atomic<int> nextBatch(0);
+    auto work = [&]() {
+        for (int batch = nextBatch.fetch_add(1, memory_order_relaxed); batch < batches;
+             batch = nextBatch.fetch_add(1, memory_order_relaxed)) {
+            const int first = batch * batchSize;
+            body(first, min(first + batchSize, count));
+        }
+    };
+
+    Vector<thread> workers;
+    workers.reserve(threads - 1);
+    for (int i = 1; i < threads; i++) {
+        workers.emplace_back(work);
+    }
+    work();
+    for (thread &worker : workers) {
+        worker.join();
+    }
+}
@@ -2,251 +2,485 @@
 #include <string>
 #include <fstream>
 #include <sstream>
+#include <climits>
+#include <utility>
+#include <string_view>
+#include <algorithm>
+#include <thread>
 
 using namespace std;
 
+/**
+ * Road closure status codes produced by loadRoadClosures.
+ * Only roads that are under repair or blocked are treated as impassable.
+ */
+constexpr int ROAD_CLEAR = 0;
+constexpr int ROAD_UNDER_REPAIR = 1;
+constexpr int ROAD_BLOCKED = 2;
+
+/**
+ * Parses an ID made of a fixed-length tag followed by a number, e.g. "V12" (tag "V") or "EV3" (tag "EV").
+ * The tag itself is not checked.
+ *
+ * @param field The ID field.
+ * @param tagLength The number of characters before the number.
+ * @param id Set to the number on success.
+ * @return True if the field holds a number after the tag, false otherwise.
+ */
+bool parseTaggedId(const string_view field, const size_t tagLength, int &id) {
+    return field.size() > tagLength && parseInt(field.substr(tagLength), id);
+}
+
+/**
+ * The smallest share of a file worth parsing on a thread of its own. Smaller files are parsed on the calling thread.
+ */
+constexpr size_t MIN_CHUNK_BYTES = 1 << 20;
+
+template<typename Table>
+/**
+ * The rows parsed from one chunk of a file by loadTableInParallel, kept apart until every chunk is done.
+ * The first chunk parses straight into the output table, so only the rows of the later chunks are copied.
+ *
+ * Worker threads must not change the shared IntersectionIndex, so a name that is not interned yet gets a
+ * placeholder index and is interned when the chunks are merged (unless the file is parsed as a single chunk,
+ * when it is interned straight away). Error messages (and echoed lines) are stored too, tagged with how many
+ * rows came before them, so they can be printed in file order during the merge.
+ *
+ * @tparam Table The table type the rows are appended to, e.g. VehicleTable.
+ */
+class TableChunk {
+public:
+    /**
+     * A name that was not interned when the chunk was parsed. Its placeholder index is -2 - (its position in
+     * pendingNames), which cannot clash with a vertex index or with -1.
+     */
+    struct PendingName {
+        int row;
+        string_view name;
+    };
+
+    /**
+     * A line to print during the merge: an error message if reason is set, otherwise the line itself.
+     * rowsBefore counts the rows of the chunk accepted before the line was read.
+     */
+    struct Message {
+        int rowsBefore;
+        int lineNumber;
+        const char *reason;
+        string_view line;
+    };
+
+    /**
+     * The shared index names are looked up in.
+     */
+    const IntersectionIndex *intersections;
+    /**
+     * The same index if this chunk is the only one and may intern names itself, nullptr otherwise.
+     */
+    IntersectionIndex *internInto;
+    /**
+     * The first byte of the chunk, always the start of a line.
+     */
+    const char *first;
+    /**
+     * One past the last byte of the chunk.
+     */
+    const char *last;
+    /**
+     * The accepted rows, in file order, after any rows the table already held.
+     */
+    Table rows;
+    /**
+     * The index of the first row parsed from the chunk.
+     */
+    int firstRow;
+    /**
+     * The names still to be interned, in the order the sequential loader would have interned them.
+     */
+    Vector<PendingName> pendingNames;
+    /**
+     * The messages to print, in file order.
+     */
+    Vector<Message> messages;
+    /**
+     * The number of lines in the chunk that were read.
+     */
+    int lineCount;
+
+    /**
+     * Constructs a chunk covering the given range of a file.
+     *
+     * @param index The shared index names are looked up in.
+     * @param onlyChunk Whether the chunk is the only one, so it may intern names into the index.
+     * @param chunkFirst The first byte of the chunk.
+     * @param chunkLast One past the last byte of the chunk.
+     * @param output The table the rows are appended to.
+     */
+    TableChunk(IntersectionIndex &index, const bool onlyChunk, const char *chunkFirst, const char *chunkLast,
+               Table &&output)
+        : intersections(&index), internInto(onlyChunk ? &index : nullptr), first(chunkFirst), last(chunkLast),
+          rows(std::move(output)), firstRow(rows.getSize()), lineCount(0) {}
+
+    /**
+     * Returns the number of rows parsed from the chunk.
+     * @return The number of accepted rows.
+     */
+    int getParsedCount() const {
+        return rows.getSize() - firstRow;
+    }
+
+    /**
+     * Returns the vertex index of an intersection for the row about to be appended. Unless the chunk may intern
+     * names itself, the name is only looked up, and a new name is left pending behind a placeholder index.
+     *
+     * @param name The intersection name.
+     * @return The vertex index, or a placeholder that the merge replaces.
+     */
+    int lookupName(const string_view name) {
+        if (internInto != nullptr) return internInto->intern(name);
+
+        const int id = intersections->find(name);
+        if (id != -1) return id;
+        pendingNames.push_back(PendingName{rows.getSize(), name});
+        return -1 - pendingNames.getSize();
+    }
+};
+
+/**
+ * Parses the rows of one chunk with the given row parser.
+ *
+ * @param chunk The chunk to fill.
+ * @param fileName The name of the file, used in error messages.
+ * @param maxRows The number of rows after which parsing stops.
+ * @param echoRows Whether every row read is printed as well.
+ * @param parseRow The row parser, see loadTableInParallel.
+ */
+template<typename Table, typename RowParser>
+void parseChunk(TableChunk<Table> &chunk, const string &fileName, const int maxRows, const bool echoRows,
+                RowParser &parseRow) {
+    CsvReader reader(chunk.first, chunk.last, fileName);
+    chunk.rows.reserve(chunk.rows.getSize() + min(reader.countRemainingLines(), maxRows));
+
+    while (chunk.getParsedCount() < maxRows && reader.nextRow()) {
+        if (echoRows) {
+            chunk.messages.push_back(typename TableChunk<Table>::Message{chunk.getParsedCount(), reader.getLineNumber(),
+                                                                         nullptr, reader.getLine()});
+        }
+        const char *reason = parseRow(reader, chunk);
+        if (reason != nullptr) {
+            chunk.messages.push_back(typename TableChunk<Table>::Message{chunk.getParsedCount(), reader.getLineNumber(),
+                                                                         reason, reader.getLine()});
+        }
+    }
+    chunk.lineCount = reader.getLineNumber();
+}
+
+/**
+ * Loads the rows of a dataset file into a table, parsing it on every core.
+ *
+ * The file is split at line boundaries into one chunk per hardware thread (each at least MIN_CHUNK_BYTES long),
+ * the chunks are parsed concurrently, and the results are merged in file order. The merge prints messages, interns
+ * new names and applies the row limit exactly as a single pass over the file would, so rows, vertex indices and
+ * output are the same as with sequential parsing, whatever the number of threads.
+ *
+ * The row parser is called as parseRow(reader, chunk) for every row read. It validates the row and returns the
+ * reason it is malformed, or appends a row to chunk.rows and returns nullptr. Intersection fields are resolved
+ * with chunk.lookupName, after the row has been validated. The table must provide getSize, reserve, appendRows
+ * and remapIntersections, like VehicleTable.
+ *
+ * @param table The table the rows are appended to.
+ * @param intersections The index that maps intersection names to vertex indices.
+ * @param fileName The name of the file.
+ * @param maxRows The number of rows the table may grow to.
+ * @param echoRows Whether every row read is printed before it is parsed.
+ * @param parseRow The row parser.
+ */
+template<typename Table, typename RowParser>
+void loadTableInParallel(Table &table, IntersectionIndex &intersections, const string &fileName, const int maxRows,
+                         const bool echoRows, RowParser parseRow) {
+    CsvReader reader;
+    if (!reader.open(fileName)) {
+        cout << "Unable to open file: " << fileName << endl;
+        return;
+    }
+
+    reader.skipLine(); // Skip header
+    const int headerLines = reader.getLineNumber();
+    const int newRows = maxRows - table.getSize();
+    if (newRows <= 0) return;
+
+    const char *first = reader.getPosition();
+    const char *last = reader.getEnd();
+    const size_t bytes = last - first;
+    const size_t chunkCount = max<size_t>(min(static_cast<size_t>(workerCount()), bytes / MIN_CHUNK_BYTES), 1);
+
+    Vector<TableChunk<Table>> chunks;
+    chunks.reserve(static_cast<int>(chunkCount));
+    const char *chunkFirst = first;
+    for (size_t i = 1; i <= chunkCount; i++) {
+        const char *chunkLast = last;
+        if (i < chunkCount) {
+            // Move the split point to the start of the next line
+            chunkLast = max(first + bytes * i / chunkCount, chunkFirst);
+            const char *newline = static_cast<const char *>(memchr(chunkLast, '\n', last - chunkLast));
+            chunkLast = newline ? newline + 1 : last;
+        }
+        chunks.emplace_back(intersections, chunkCount == 1, chunkFirst, chunkLast, i == 1 ? std::move(table) : Table());
+        chunkFirst = chunkLast;
+    }
+
+    // The calling thread parses the last chunk itself
+    Vector<thread> workers;
+    workers.reserve(chunks.getSize() - 1);
+    for (int i = 0; i + 1 < chunks.getSize(); i++) {
+        workers.emplace_back([&, i]() {
+            parseChunk(chunks[i], fileName, newRows, echoRows, parseRow);
+        });
+    }
+    parseChunk(chunks[chunks.getSize() - 1], fileName, newRows, echoRows, parseRow);
+    for (thread &worker : workers) {
+        worker.join();
+    }
+
+    // The first chunk was parsed straight into the table; the later chunks are appended behind it
+    Table &merged = chunks[0].rows;
+    int parsedRows = 0;
+    for (const TableChunk<Table> &chunk : chunks) {
+        parsedRows += chunk.getParsedCount();
+    }
+    merged.reserve(chunks[0].firstRow + min(parsedRows, newRows));
+
+    int rowCount = chunks[0].firstRow;
+    int lineBase = headerLines;
+    Vector<int> pendingIds;
+    for (int c = 0; c < chunks.getSize() && rowCount < maxRows; c++) {
+        TableChunk<Table> &chunk = chunks[c];
+        const int remaining = maxRows - rowCount;
+        const int taken = min(chunk.getParsedCount(), remaining);
+
+        // Print what the sequential loader would have printed before stopping
+        for (const typename TableChunk<Table>::Message &m : chunk.messages) {
+            if (m.rowsBefore >= remaining) break;
+            if (m.reason == nullptr) {
+                cout << m.line << endl;
+            } else {
+                CsvReader::printMalformed(fileName, lineBase + m.lineNumber, m.reason);
+            }
+        }
+
+        // Intern the new names of the rows that are kept, in file order
+        pendingIds.clear();
+        for (const typename TableChunk<Table>::PendingName &name : chunk.pendingNames) {
+            if (name.row >= chunk.firstRow + taken) break;
+            pendingIds.push_back(intersections.intern(name.name));
+        }
+
+        if (c > 0) merged.appendRows(chunk.rows, 0, taken);
+        if (!pendingIds.isEmpty()) {
+            merged.remapIntersections(rowCount, [&pendingIds](const int id) {
+                return id < -1 ? pendingIds[-2 - id] : id;
+            });
+        }
+        rowCount += taken;
+        lineBase += chunk.lineCount;
+    }
+    table = std::move(merged);
+}
+
 /**
  * Loads a road network from a CSV file into a given graph.
  *
  * The CSV file is expected to have a header and subsequent rows
  * that define edges in the form of: Intersection1, Intersection2, TravelTime.
  * Each edge is added to the graph with an associated weight (TravelTime).
- * The intersections are internally represented by integers derived from their respective
- * first character's alphabetical index (e.g., 'A' -> 0, 'B' -> 1, ...).
+ * Intersection names are arbitrary strings, interned into dense vertex indices in order of first appearance.
+ * The graph grows as new intersections are seen.
+ * The file is read through CsvReader; rows without a valid travel time are reported with their line number and skipped.
  *
  * @param graph The graph object where the road network will be loaded.
+ * @param intersections The index that maps intersection names to vertex indices.
  * @param fileName The name of the CSV file containing the road network data.
  */
-void loadRoadNetwork(Graph &graph, const string &fileName) {
-    ifstream file(fileName);
-    if (!file.is_open()) {
+void loadRoadNetwork(Graph &graph, IntersectionIndex &intersections, const string &fileName) {
+    CsvReader reader;
+    if (!reader.open(fileName)) {
         cout << "Unable to open file: " << fileName << endl;
         return;
     }
 
-    string line;
-    getline(file, line); // Skip header
-
-    while (getline(file, line)) {
-        istringstream iss(line);
-
-        string temp;
+    reader.skipLine(); // Skip header
 
-        getline(iss, temp, ',');
-        int u = temp[0] - 'A';
-
-        getline(iss, temp, ',');
-        int v = temp[0] - 'A';
+    while (reader.nextRow()) {
+        float weight;
+        if (reader.getFieldCount() < 3) {
+            reader.reportMalformed("expected Intersection1, Intersection2, TravelTime");
+            continue;
+        }
+        if (!parseFloat(reader.getField(2), weight)) {
+            reader.reportMalformed("invalid travel time");
+            continue;
+        }
 
-        getline(iss, temp, ',');
-        float weight = stof(temp);
+        int u = intersections.intern(reader.getField(0));
+        int v = intersections.intern(reader.getField(1));
 
+        while (graph.getSize() < intersections.getSize()) {
+            graph.addNode();
+        }
         graph.addEdge(u, v, weight);
     }
-
-    file.close();
 }
 
 /**
- * Loads vehicle data from a CSV file into a vector of vectors.
+ * Loads vehicle data from a CSV file into a vehicle table.
  *
  * The function reads entries from a specified file, parsing each line into
  * vehicle data that includes an identifier and two location indices. It
  * continues to parse lines until the specified number of vehicles is reached
  * or the file has no more lines. Each vehicle's data consists of three
  * integers: ID, start location, and end location.
+ * Rows with a missing field or an unparsable ID are reported with their line number and skipped.
+ * Large files are parsed on every core by loadTableInParallel, with the same result as a single pass.
  *
- * @param vehicles A reference to a vector where parsed vehicle data will be stored.
+ * @param vehicles The table the parsed vehicles are appended to.
+ * @param intersections The index that maps intersection names to vertex indices.
  * @param fileName The name of the file containing vehicle data in CSV format.
  * @param numVehicles The maximum number of vehicles to load.
  */
-void loadVehicles(Vector<Vector<int>> &vehicles, const string &fileName, int numVehicles = INT_MAX) {
-    ifstream file(fileName);
-    if (!file.is_open()) {
-        cout << "Unable to open file: " << fileName << endl;
-        return;
-    }
-
-    string line;
-    getline(file, line); // Skip header
-
-    while (getline(file, line) && vehicles.getSize() < numVehicles) {
-        istringstream iss(line);
-
-        string temp;
-
-        getline(iss, temp, ',');
-        int id = stoi(temp.substr(1));
-
-        getline(iss, temp, ',');
-        int start = temp[0] - 'A';
-
-        getline(iss, temp, ',');
-        int end = temp[0] - 'A';
-
-        Vector<int> vehicleData;
-        vehicleData.push_back(id);
-        vehicleData.push_back(start);
-        vehicleData.push_back(end);
-        vehicles.push_back(vehicleData);
-    }
-
-    file.close();
+void loadVehicles(VehicleTable &vehicles, IntersectionIndex &intersections, const string &fileName, int numVehicles = INT_MAX) {
+    loadTableInParallel(vehicles, intersections, fileName, numVehicles, false,
+                        [](const CsvReader &reader, TableChunk<VehicleTable> &chunk) -> const char * {
+        int id;
+        if (reader.getFieldCount() < 3) return "expected VehicleID, StartIntersection, EndIntersection";
+        if (!parseTaggedId(reader.getField(0), 1, id)) return "invalid vehicle ID";
+
+        int start = chunk.lookupName(reader.getField(1));
+        int end = chunk.lookupName(reader.getField(2));
+        chunk.rows.append(id, start, end);
+        return nullptr;
+    });
 }
 
 /**
- * Loads traffic signal data from a file into a vector.
+ * Loads traffic signal data from a file into a signal table.
  *
  * This function reads a specified file containing traffic signal information.
  * The file is expected to have data in a comma-separated format with a header.
  * Each line after the header should contain an intersection identifier and a green time value.
  *
- * @param trafficSignals A vector of vectors where the traffic signal data will be stored.
- *                       Each inner vector contains two integers: the first is the intersection index (starting from 'A'),
- *                       and the second is the green time for that intersection.
+ * @param trafficSignals The table the traffic signals are appended to: the intersection index
+ *                       and the green time for that intersection.
+ * @param intersections The index that maps intersection names to vertex indices.
  * @param fileName The name of the file containing the traffic signal data.
  *
  * If the file cannot be opened, a message will be printed to the standard output.
  */
-void loadTrafficSignals(Vector<Vector<int>> &trafficSignals, const string &fileName) {
-    ifstream file(fileName);
-    if (!file.is_open()) {
+void loadTrafficSignals(SignalTable &trafficSignals, IntersectionIndex &intersections, const string &fileName) {
+    CsvReader reader;
+    if (!reader.open(fileName)) {
         cout << "Unable to open file: " << fileName << endl;
         return;
     }
 
-    string line;
-    getline(file, line); // Skip header
-
-    while (getline(file, line)) {
-        istringstream iss(line);
+    reader.skipLine(); // Skip header
+    trafficSignals.reserve(trafficSignals.getSize() + reader.countRemainingLines());
 
-        string temp;
-
-        getline(iss, temp, ',');
-        int intersection = temp[0] - 'A';
+    while (reader.nextRow()) {
+        int greenTime;
+        if (reader.getFieldCount() < 2) {
+            reader.reportMalformed("expected Intersection, GreenTime");
+            continue;
+        }
+        if (!parseInt(reader.getField(1), greenTime)) {
+            reader.reportMalformed("invalid green time");
+            continue;
+        }
 
-        getline(iss, temp, ',');
-        int greenTime = stoi(temp);
+        int intersection = intersections.intern(reader.getField(0));
 
-        Vector<int> signalData;
-        signalData.push_back(intersection);
-        signalData.push_back(greenTime);
-        trafficSignals.push_back(signalData);
+        trafficSignals.append(intersection, greenTime);
     }
-
-    file.close();
 }
 
 /**
- * Loads road closure data from a specified file and stores it in a provided vector.
+ * Loads road closure data from a specified file and stores it in a provided closure table.
  *
  * Reads and parses a CSV file to extract road closure information between intersections.
  * Each line in the file should contain data in the format: intersection1,intersection2,status.
- * Intersections are represented as uppercase letters, and the status can be one of:
+ * Intersections are named by arbitrary strings, and the status can be one of:
  * "Under Repair", "Blocked", or default to "Clear".
  *
- * @param roadClosures A reference to a Vector of Vectors storing road closure data.
- *                     Each inner vector contains three integers: two intersection indices
- *                     and one status code.
+ * @param roadClosures The table the closures are appended to: two intersection indices
+ *                     and one status code per road.
+ * @param intersections The index that maps intersection names to vertex indices.
  * @param fileName The path to the CSV file containing road closure information.
  */
-void loadRoadClosures(Vector<Vector<int> > &roadClosures, const string &fileName) {
-    ifstream file(fileName);
-    if (!file.is_open()) {
+void loadRoadClosures(ClosureTable &roadClosures, IntersectionIndex &intersections, const string &fileName) {
+    CsvReader reader;
+    if (!reader.open(fileName)) {
         cout << "Unable to open file: " << fileName << endl;
         return;
     }
 
-    string line;
-    getline(file, line); // Skip header
-
-    while (getline(file, line)) {
-        if (line == ",,") continue;
-
-        istringstream iss(line);
+    reader.skipLine(); // Skip header
+    roadClosures.reserve(roadClosures.getSize() + reader.countRemainingLines());
 
-        string temp;
-
-        getline(iss, temp, ',');
-        int intersection1 = temp[0] - 'A';
-
-        getline(iss, temp, ',');
-        int intersection2 = temp[0] - 'A';
+    // Empty rows such as ",," are skipped by the reader
+    while (reader.nextRow()) {
+        if (reader.getFieldCount() < 3) {
+            reader.reportMalformed("expected Intersection1, Intersection2, Status");
+            continue;
+        }
 
-        getline(iss, temp, ',');
+        int intersection1 = intersections.intern(reader.getField(0));
+        int intersection2 = intersections.intern(reader.getField(1));
 
+        const string_view statusName = reader.getField(2);
         int status;
-        if (temp == "Under Repair") {
-            status = 1;
-        } else if (temp == "Blocked") {
-            status = 2;
+        if (statusName == "Under Repair") {
+            status = ROAD_UNDER_REPAIR;
+        } else if (statusName == "Blocked") {
+            status = ROAD_BLOCKED;
         } else {
-            status = 0; // Default to "Clear"
+            status = ROAD_CLEAR; // Default to "Clear"
         }
 
-        Vector<int> closureData;
-        closureData.push_back(intersection1);
-        closureData.push_back(intersection2);
-        closureData.push_back(status);
-        roadClosures.push_back(closureData);
+        roadClosures.append(intersection1, intersection2, status);
     }
-
-    file.close();
 }
 
 /**
- * Loads emergency vehicle data from a specified file into a vector of vectors.
+ * Loads emergency vehicle data from a specified file into an emergency vehicle table.
  * Each vehicle's data includes an ID, start point, end point, and priority level.
+ * Every row read is echoed. Large files are parsed on every core by loadTableInParallel, with the same
+ * result and output as a single pass.
  *
- * @param emergencyVehicles A reference to a vector where emergency vehicle data will be stored.
+ * @param emergencyVehicles The table the parsed emergency vehicles are appended to.
+ * @param intersections The index that maps intersection names to vertex indices.
  * @param fileName The name of the file containing emergency vehicle data.
  * @param numVehicles The maximum number of vehicle records to load.
  */
-void loadEmergencyVehicles(Vector<Vector<int>> &emergencyVehicles, const string &fileName, int numVehicles = INT_MAX) {
-    ifstream file(fileName);
-    if (!file.is_open()) {
-        cout << "Unable to open file: " << fileName << endl;
-        return;
-    }
-
-    string line;
-    getline(file, line); // Skip header
-
-    while (getline(file, line) && emergencyVehicles.getSize() < numVehicles) {
-        if (line == ",,,") continue;
-        istringstream iss(line);
-        cout << line << endl;
-        string temp;
-
-        getline(iss, temp, ',');
-        int id = stoi(temp.substr(2));
-
-        getline(iss, temp, ',');
-        int start = temp[0] - 'A';
-
-        getline(iss, temp, ',');
-        int end = temp[0] - 'A';
-
-        getline(iss, temp, ',');
-
+void loadEmergencyVehicles(EmergencyVehicleTable &emergencyVehicles, IntersectionIndex &intersections, const string &fileName, int numVehicles = INT_MAX) {
+    // Empty rows such as ",,," are skipped by the reader
+    loadTableInParallel(emergencyVehicles, intersections, fileName, numVehicles, true,
+                        [](const CsvReader &reader, TableChunk<EmergencyVehicleTable> &chunk) -> const char * {
+        int id;
+        if (reader.getFieldCount() < 4) return "expected VehicleID, StartIntersection, EndIntersection, PriorityLevel";
+        if (!parseTaggedId(reader.getField(0), 2, id)) return "invalid vehicle ID";
+
+        const string_view priorityName = reader.getField(3);
         int priority;
-        if (temp == "Medium") {
+        if (priorityName == "Medium") {
             priority = 1;
-        } else if (temp == "High") {
+        } else if (priorityName == "High") {
             priority = 2;
         } else {
             priority = 0; // Default, none
         }
 
-        Vector<int> emVehicleData;
-        emVehicleData.push_back(id);
-        emVehicleData.push_back(start);
-        emVehicleData.push_back(end);
-        emVehicleData.push_back(priority);
-
-        emergencyVehicles.push_back(emVehicleData);
-    }
-
-    file.close();
+        int start = chunk.lookupName(reader.getField(1));
+        int end = chunk.lookupName(reader.getField(2));
+        chunk.rows.append(id, start, end, priority);
+        return nullptr;
+    });
 }
@@ -6,12 +6,12 @@
 using namespace std;
 
 struct TrafficSignal {
-    int intersection;  // Intersection represented by a number (0-25 for 'A' to 'Z')
+    int intersection;  // Intersection represented by its vertex index (see IntersectionIndex)
     int vehicleDensity;  // Vehicle density at the intersection
     int greenTime;  // Duration for which the light stays green
 
     // Constructor to initialize the signal
-    TrafficSignal(int intersection, int vehicleDensity, int greenTime)
+    TrafficSignal(int intersection = -1, int vehicleDensity = 0, int greenTime = 0)
         : intersection(intersection), vehicleDensity(vehicleDensity), greenTime(greenTime) {}
 
     // Comparator for the priority queue to prioritize higher vehicle density
@@ -33,67 +33,66 @@ void adjustGreenDuration(TrafficSignal& signal) {
 template<typename T>
 class PriorityQueue {
 private:
-    // Custom struct to store value and priority
+    // Custom struct to store value and priority, plus the order in which it was enqueued
     struct Element {
         T value;
         int priority;
+        long long sequence;
 
-        Element(const T &val, int pri) : value(val), priority(pri) {}
+        Element(const T &val, int pri, long long seq) : value(val), priority(pri), sequence(seq) {}
     };
 
-    // Vector to store elements
-    Vector<Element> data;
-
-    // Method to reorder the priority queue based on priority values
-    void reorder() {
-        // Simple selection sort to reorder based on priority (highest priority first)
-        for (int i = 0; i < data.getSize(); i++) {
-            for (int j = i + 1; j < data.getSize(); j++) {
-                if (data[i].priority < data[j].priority) {
-                    // Swap if current element has lower priority
-                    Element temp = data[i];
-                    data[i] = data[j];
-                    data[j] = temp;
-                }
-            }
+    // Orders elements so the heap top is the highest priority, and among equal priorities the earliest enqueued
+    struct ElementOrder {
+        bool operator()(const Element &a, const Element &b) const {
+            if (a.priority != b.priority) return a.priority > b.priority;
+            return a.sequence < b.sequence;
         }
-    }
+    };
+
+    // Binary heap holding the elements, O(log n) per enqueue and dequeue
+    MinHeap<Element, ElementOrder> heap;
+
+    // Counter stamped on every enqueued element to keep equal priorities in FIFO order
+    long long nextSequence = 0;
 
 public:
     // Enqueue method to add an element with a priority
     void enqueue(const T &value, int priority) {
-        // Create an Element object and push it into the vector
-        Element newElement(value, priority);
-        data.push_back(newElement);
-        reorder();  // Reorder elements after insertion
+        heap.insert(Element(value, priority, nextSequence++));
     }
 
     // Dequeue method to remove and return the element with the highest priority
     T dequeue() {
-        if (data.getSize() == 0) {
-            cout << "Priority queue is empty!";
+        if (heap.isEmpty()) {
+            cout << "Priority queue is empty!" << endl;
+            exit(1);
         }
-        T highestPriorityValue = data[0].value;
-        data.removeAt(0);  // Remove the element with the highest priority
-        return highestPriorityValue;
+        return heap.extractMin().value;
     }
 
     // Check if the priority queue is empty
     bool isEmpty() const {
-        return data.getSize() == 0;
+        return heap.isEmpty();
     }
 
     // Peek at the element with the highest priority without removing it
     T peek() const {
-        if (data.getSize() == 0) {
-            cout << "Priority queue is empty!";
+        if (heap.isEmpty()) {
+            cout << "Priority queue is empty!" << endl;
+            exit(1);
         }
-        return data[0].value;
+        return heap.getMin().value;
     }
 
     // Get the size of the priority queue
     int size() const {
-        return data.getSize();
+        return heap.size();
+    }
+
+    // Reserve room for the given number of elements, e.g. one per intersection before a signal tick
+    void reserve(int capacity) {
+        heap.reserve(capacity);
     }
 };
 
@@ -2,36 +2,147 @@
 #include <string>
 #include <fstream>
 #include <sstream>
+#include <cstddef>
+#include <iterator>
+#include <utility>
 
 using namespace std;
 
 template<typename T>
 /**
  * @class Queue
- * @brief A template class implementing a queue data structure using a vector as storage.
+ * @brief A template class implementing a queue data structure as a circular buffer.
+ *
+ * Elements live in a power-of-two array and the front index wraps around it, so enqueue and dequeue
+ * are amortised O(1) and dequeuing never copies the remaining elements.
  *
  * @tparam T The type of the elements stored in the queue.
  */
 class Queue {
     /**
-     * A vector container to store elements of the queue.
-     * Utilizes a dynamic array for efficient element management.
+     * The circular buffer holding the elements. Its length is capacity, always zero or a power of two.
+     */
+    T *buffer;
+    /**
+     * The number of slots in buffer.
      */
-    Vector<T> data;
+    int capacity;
     /**
      * @brief Index indicating the front element in the queue.
-     * @details Used to track the position of the first element in the queue for dequeuing.
-     * Automatically adjusted when elements are dequeued to maintain efficient access.
+     * @details Advances (and wraps around the buffer) each time an element is dequeued.
      */
     int frontIdx;
+    /**
+     * The number of elements currently in the queue.
+     */
+    int count;
+
+    /**
+     * Moves the elements into a new buffer of the given capacity, unwrapping them so the front is at index 0.
+     *
+     * @param newCapacity The new number of slots. Must be a power of two and at least count.
+     */
+    void resize(const int newCapacity) {
+        T *newBuffer = new T[newCapacity];
+        for (int i = 0; i < count; i++) {
+            newBuffer[i] = std::move(buffer[(frontIdx + i) & (capacity - 1)]);
+        }
+        delete[] buffer;
+        buffer = newBuffer;
+        capacity = newCapacity;
+        frontIdx = 0;
+    }
 
     /**
-     * Constructs a Queue object and initializes the front index to zero.
+     * Constructs an empty Queue. No storage is allocated until the first enqueue or reserve.
      *
-     * @return A new instance of a Queue with an initialized front index.
+     * @return A new instance of an empty Queue.
      */
 public:
-    Queue() : frontIdx(0) {}
+    Queue() : buffer(nullptr), capacity(0), frontIdx(0), count(0) {}
+
+    /**
+     * Copy constructor. Copies the elements of another queue in order.
+     *
+     * @param other The queue to copy from.
+     */
+    Queue(const Queue &other) : buffer(nullptr), capacity(0), frontIdx(0), count(0) {
+        reserve(other.count);
+        for (int i = 0; i < other.count; i++) {
+            buffer[i] = other.buffer[(other.frontIdx + i) & (other.capacity - 1)];
+        }
+        count = other.count;
+    }
+
+    /**
+     * Move constructor. Takes over the buffer of another queue, leaving it empty.
+     *
+     * @param other The queue to move from.
+     */
+    Queue(Queue &&other) noexcept
+        : buffer(other.buffer), capacity(other.capacity), frontIdx(other.frontIdx), count(other.count) {
+        other.buffer = nullptr;
+        other.capacity = 0;
+        other.frontIdx = 0;
+        other.count = 0;
+    }
+
+    /**
+     * Copy assignment. Replaces the contents with a copy of another queue.
+     *
+     * @param other The queue to copy from.
+     * @return A reference to this queue.
+     */
+    Queue &operator=(const Queue &other) {
+        if (this != &other) {
+            Queue copy(other);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    /**
+     * Move assignment. Releases the current buffer and takes over the buffer of another queue.
+     *
+     * @param other The queue to move from.
+     * @return A reference to this queue.
+     */
+    Queue &operator=(Queue &&other) noexcept {
+        if (this != &other) {
+            delete[] buffer;
+            buffer = other.buffer;
+            capacity = other.capacity;
+            frontIdx = other.frontIdx;
+            count = other.count;
+            other.buffer = nullptr;
+            other.capacity = 0;
+            other.frontIdx = 0;
+            other.count = 0;
+        }
+        return *this;
+    }
+
+    /**
+     * Destructor. Releases the circular buffer.
+     */
+    ~Queue() {
+        delete[] buffer;
+    }
+
+    /**
+     * Ensures the queue can hold at least the given number of elements without growing.
+     * The capacity is rounded up to the next power of two.
+     *
+     * @param minCapacity The number of elements to make room for.
+     */
+    void reserve(const int minCapacity) {
+        if (minCapacity <= capacity) return;
+        int newCapacity = capacity == 0 ? 1 : capacity;
+        while (newCapacity < minCapacity) {
+            newCapacity *= 2;
+        }
+        resize(newCapacity);
+    }
 
     /**
      * Adds a new element to the end of the queue.
@@ -39,7 +150,24 @@ public:
      * @param value The element to be added to the queue.
      */
     void enqueue(const T &value) {
-        data.push_back(value);
+        if (count == capacity) {
+            resize(capacity == 0 ? 4 : capacity * 2);
+        }
+        buffer[(frontIdx + count) & (capacity - 1)] = value;
+        count++;
+    }
+
+    /**
+     * Adds a new element to the end of the queue, moving it into place.
+     *
+     * @param value The element to be moved into the queue.
+     */
+    void enqueue(T &&value) {
+        if (count == capacity) {
+            resize(capacity == 0 ? 4 : capacity * 2);
+        }
+        buffer[(frontIdx + count) & (capacity - 1)] = std::move(value);
+        count++;
     }
 
     /**
@@ -54,16 +182,9 @@ public:
             exit(1);
         }
 
-        T frontElement = data[frontIdx];
-        frontIdx++;
-        if (frontIdx > data.getSize() / 2) {
-            Vector<T> newData;
-            for (int i = frontIdx; i < data.getSize(); i++) {
-                newData.push_back(data[i]);
-            }
-            data = newData;
-            frontIdx = 0;
-        }
+        T frontElement = std::move(buffer[frontIdx]);
+        frontIdx = (frontIdx + 1) & (capacity - 1);
+        count--;
 
         return frontElement;
     }
@@ -80,7 +201,7 @@ public:
             exit(1);
         }
 
-        return data[frontIdx];
+        return buffer[frontIdx];
     }
 
     /**
@@ -88,27 +209,128 @@ public:
      * @return True if the queue is empty, false otherwise.
      */
     bool isEmpty() const {
-        return frontIdx >= data.getSize();
+        return count == 0;
     }
 
     /**
-     * Calculates the number of elements currently in the queue.
+     * Returns the number of elements currently in the queue.
      *
-     * @return The number of elements in the queue from the front index to the end.
+     * @return The number of elements in the queue.
      */
     int size() const {
-        return data.getSize() - frontIdx;
+        return count;
+    }
+
+    /**
+     * A read-only forward iterator over the queued elements, from the front of the queue to the back.
+     * Enqueuing or dequeuing invalidates every iterator.
+     */
+    class const_iterator {
+        /**
+         * The queue being walked.
+         */
+        const Queue *queue;
+        /**
+         * The distance of the current element from the front of the queue.
+         */
+        int offset;
+
+    public:
+        typedef forward_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef ptrdiff_t difference_type;
+        typedef const T *pointer;
+        typedef const T &reference;
+
+        /**
+         * Constructs an iterator to the element at the given distance from the front of a queue.
+         *
+         * @param q The queue to walk.
+         * @param position The distance from the front; the queue's size gives the end iterator.
+         */
+        const_iterator(const Queue *q, const int position) : queue(q), offset(position) {}
+
+        /**
+         * Returns the element the iterator points to.
+         * @return A const reference to the current element.
+         */
+        reference operator*() const {
+            return queue->buffer[(queue->frontIdx + offset) & (queue->capacity - 1)];
+        }
+
+        /**
+         * Gives member access to the element the iterator points to.
+         * @return A pointer to the current element.
+         */
+        pointer operator->() const {
+            return &**this;
+        }
+
+        /**
+         * Advances to the next element towards the back of the queue.
+         * @return A reference to this iterator.
+         */
+        const_iterator &operator++() {
+            offset++;
+            return *this;
+        }
+
+        /**
+         * Advances to the next element, returning the iterator's previous position.
+         * @return An iterator to the element before the advance.
+         */
+        const_iterator operator++(int) {
+            const_iterator previous = *this;
+            offset++;
+            return previous;
+        }
+
+        /**
+         * Checks whether two iterators point to the same element.
+         *
+         * @param other The iterator to compare with.
+         * @return True if both point to the same position of the same queue.
+         */
+        bool operator==(const const_iterator &other) const {
+            return queue == other.queue && offset == other.offset;
+        }
+
+        /**
+         * Checks whether two iterators point to different elements.
+         *
+         * @param other The iterator to compare with.
+         * @return True if the iterators point to different positions.
+         */
+        bool operator!=(const const_iterator &other) const {
+            return !(*this == other);
+        }
+    };
+
+    /**
+     * Returns an iterator to the front element.
+     * @return A read-only iterator to the front of the queue.
+     */
+    const_iterator begin() const {
+        return const_iterator(this, 0);
+    }
+
+    /**
+     * Returns the iterator that follows the back element.
+     * @return The read-only end iterator.
+     */
+    const_iterator end() const {
+        return const_iterator(this, count);
     }
 
     /**
-     * Displays the content of the queue starting from frontIdx to the end in a comma-separated format enclosed in brackets.
+     * Displays the content of the queue from front to back in a comma-separated format enclosed in brackets.
      * The output is printed to the standard console.
      */
     void display() const {
         cout << "[";
-        for (int i = frontIdx; i < data.getSize(); i++) {
-            cout << data[i];
-            if (i < data.getSize() - 1) cout << ", ";
+        for (int i = 0; i < count; i++) {
+            cout << buffer[(frontIdx + i) & (capacity - 1)];
+            if (i < count - 1) cout << ", ";
         }
 
         cout << "]" << endl;
@@ -0,0 +1,275 @@
+#include <iostream>
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string_view>
+
+using namespace std;
+
+/**
+ * The binary road network format.
+ *
+ * A file starts with a RoadNetworkHeader, followed by four arrays and a block of name bytes:
+ *
+ *     nameOffsets   uint32[numVertices + 1]   byte range of every intersection name within the name block
+ *     edgeOffsets   int32[numVertices + 1]    CSR offsets: the edges of vertex u are [edgeOffsets[u], edgeOffsets[u + 1])
+ *     targets       int32[numEdges]           target vertex of every edge
+ *     weights       float[numEdges]           travel time of every edge
+ *     names         char[namesBytes]          the intersection names, back to back, in vertex index order
+ *
+ * Everything is stored in the byte order of the machine that wrote the file, so the arrays can be used
+ * straight from the mapped file. The header records the size and modification time of the CSV the file was
+ * converted from; if the CSV has changed since, the binary file is stale and the CSV is parsed instead.
+ */
+constexpr char ROAD_NETWORK_MAGIC[8] = {'R', 'O', 'A', 'D', 'N', 'E', 'T', 0};
+/**
+ * The current version of the binary road network format. Files with a different version are ignored.
+ */
+constexpr uint32_t ROAD_NETWORK_FORMAT_VERSION = 1;
+/**
+ * Written as is into every file; reads back differently on a machine with the other byte order.
+ */
+constexpr uint32_t ROAD_NETWORK_BYTE_ORDER = 0x01020304;
+
+/**
+ * The fixed-size header at the start of a binary road network file.
+ */
+struct RoadNetworkHeader {
+    /**
+     * ROAD_NETWORK_MAGIC, identifying the file type.
+     */
+    char magic[8];
+    /**
+     * The format version the file was written with.
+     */
+    uint32_t version;
+    /**
+     * ROAD_NETWORK_BYTE_ORDER as written by the producing machine.
+     */
+    uint32_t byteOrder;
+    /**
+     * The size in bytes of the CSV file the network was converted from.
+     */
+    int64_t sourceSize;
+    /**
+     * The modification time (seconds since the epoch) of the CSV file the network was converted from.
+     */
+    int64_t sourceModified;
+    /**
+     * The number of intersections.
+     */
+    int32_t numVertices;
+    /**
+     * The number of roads.
+     */
+    int32_t numEdges;
+    /**
+     * The length of the name block in bytes.
+     */
+    uint64_t namesBytes;
+};
+
+static_assert(sizeof(RoadNetworkHeader) == 48, "RoadNetworkHeader must have the same layout everywhere");
+static_assert(sizeof(float) == 4, "Edge weights are stored as 32-bit floats");
+
+/**
+ * Writes a loaded road network to a binary file that loadRoadNetworkBinary can map back in.
+ * The file is written under a temporary name and renamed into place, so a reader never sees a partial file.
+ *
+ * @param graph The road network. Its vertex indices must match the intersection index one to one.
+ * @param intersections The names of the graph's vertices, e.g. as interned by loadRoadNetwork.
+ * @param csvFileName The CSV file the network was loaded from. Its size and modification time are recorded.
+ * @param binaryFileName The path of the binary file to write.
+ * @return True if the file was written, false otherwise.
+ */
+bool writeRoadNetworkBinary(const Graph &graph, const IntersectionIndex &intersections, const string &csvFileName,
+                            const string &binaryFileName) {
+    if (graph.getSize() != intersections.getSize()) {
+        cout << "Error: Intersection names do not match the graph." << endl;
+        return false;
+    }
+
+    RoadNetworkHeader header{};
+    memcpy(header.magic, ROAD_NETWORK_MAGIC, sizeof(header.magic));
+    header.version = ROAD_NETWORK_FORMAT_VERSION;
+    header.byteOrder = ROAD_NETWORK_BYTE_ORDER;
+    long long sourceSize, sourceModified;
+    if (!getFileStamp(csvFileName, sourceSize, sourceModified)) {
+        cout << "Unable to open file: " << csvFileName << endl;
+        return false;
+    }
+    header.sourceSize = sourceSize;
+    header.sourceModified = sourceModified;
+
+    const CSRGraph &network = graph.getSnapshot();
+    const int numVertices = network.getSize();
+    header.numVertices = numVertices;
+    header.numEdges = network.getEdgeCount();
+
+    Vector<uint32_t> nameOffsets;
+    nameOffsets.reserve(numVertices + 1);
+    string names;
+    for (int i = 0; i < numVertices; i++) {
+        nameOffsets.push_back(static_cast<uint32_t>(names.size()));
+        names += intersections.getName(i);
+    }
+    nameOffsets.push_back(static_cast<uint32_t>(names.size()));
+    header.namesBytes = names.size();
+
+    Vector<int32_t> edgeOffsets;
+    edgeOffsets.reserve(numVertices + 1);
+    for (int u = 0; u <= numVertices; u++) {
+        edgeOffsets.push_back(u < numVertices ? network.edgeBegin(u) : network.getEdgeCount());
+    }
+    Vector<int32_t> targets;
+    Vector<float> weights;
+    targets.reserve(header.numEdges);
+    weights.reserve(header.numEdges);
+    for (int e = 0; e < header.numEdges; e++) {
+        targets.push_back(network.getTarget(e));
+        weights.push_back(network.getWeight(e));
+    }
+
+    const string tempFileName = binaryFileName + ".tmp";
+    ofstream file(tempFileName, ios::binary | ios::trunc);
+    if (!file.is_open()) {
+        cout << "Unable to write file: " << tempFileName << endl;
+        return false;
+    }
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char *>(nameOffsets.begin()), sizeof(uint32_t) * nameOffsets.getSize());
+    file.write(reinterpret_cast<const char *>(edgeOffsets.begin()), sizeof(int32_t) * edgeOffsets.getSize());
+    file.write(reinterpret_cast<const char *>(targets.begin()), sizeof(int32_t) * targets.getSize());
+    file.write(reinterpret_cast<const char *>(weights.begin()), sizeof(float) * weights.getSize());
+    file.write(names.data(), static_cast<streamsize>(names.size()));
+    file.close();
+    if (!file) {
+        cout << "Unable to write file: " << tempFileName << endl;
+        remove(tempFileName.c_str());
+        return false;
+    }
+
+    // rename does not replace an existing file on every platform
+    remove(binaryFileName.c_str());
+    if (rename(tempFileName.c_str(), binaryFileName.c_str()) != 0) {
+        cout << "Unable to write file: " << binaryFileName << endl;
+        remove(tempFileName.c_str());
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Converts a road network CSV file (as read by loadRoadNetwork) into the binary format.
+ *
+ * @param csvFileName The CSV file to convert.
+ * @param binaryFileName The path of the binary file to write.
+ * @return True if the binary file was written, false otherwise.
+ */
+bool convertRoadNetwork(const string &csvFileName, const string &binaryFileName) {
+    Graph graph(0);
+    IntersectionIndex intersections;
+    loadRoadNetwork(graph, intersections, csvFileName);
+    return writeRoadNetworkBinary(graph, intersections, csvFileName, binaryFileName);
+}
+
+/**
+ * Loads a road network from a binary file written by writeRoadNetworkBinary, without parsing any text.
+ *
+ * The file is memory-mapped, checked, and its CSR arrays are handed to the graph as they are. The load is
+ * refused, leaving the graph and the index untouched, if the file is missing, has the wrong magic, version or
+ * byte order, is truncated or inconsistent, or is stale because the CSV it was converted from has changed.
+ * A missing CSV does not make the file stale, so the binary file can be shipped on its own.
+ *
+ * @param graph The graph to fill. Must have no vertices yet.
+ * @param intersections The index to fill with the intersection names. Must be empty.
+ * @param csvFileName The CSV file the binary file was converted from.
+ * @param binaryFileName The binary file to load.
+ * @return True if the network was loaded, false if the caller should fall back to the CSV file.
+ */
+bool loadRoadNetworkBinary(Graph &graph, IntersectionIndex &intersections, const string &csvFileName,
+                           const string &binaryFileName) {
+    if (graph.getSize() != 0 || intersections.getSize() != 0) return false;
+
+    MappedFile file;
+    if (!file.open(binaryFileName) || file.getSize() < sizeof(RoadNetworkHeader)) return false;
+
+    RoadNetworkHeader header;
+    memcpy(&header, file.getData(), sizeof(header));
+    if (memcmp(header.magic, ROAD_NETWORK_MAGIC, sizeof(header.magic)) != 0 ||
+        header.version != ROAD_NETWORK_FORMAT_VERSION || header.byteOrder != ROAD_NETWORK_BYTE_ORDER ||
+        header.numVertices < 0 || header.numEdges < 0) {
+        return false;
+    }
+
+    long long sourceSize, sourceModified;
+    if (getFileStamp(csvFileName, sourceSize, sourceModified) &&
+        (sourceSize != header.sourceSize || sourceModified != header.sourceModified)) {
+        return false;
+    }
+
+    const unsigned long long numVertices = static_cast<unsigned long long>(header.numVertices);
+    const unsigned long long numEdges = static_cast<unsigned long long>(header.numEdges);
+    const unsigned long long expectedSize = sizeof(RoadNetworkHeader) + 8 * (numVertices + 1) + 8 * numEdges +
+                                            header.namesBytes;
+    if (file.getSize() != expectedSize) return false;
+
+    // The header is 48 bytes and every array holds 4-byte values, so the arrays are suitably aligned in the mapping
+    const char *cursor = file.getData() + sizeof(RoadNetworkHeader);
+    const uint32_t *nameOffsets = reinterpret_cast<const uint32_t *>(cursor);
+    cursor += sizeof(uint32_t) * (numVertices + 1);
+    const int32_t *edgeOffsets = reinterpret_cast<const int32_t *>(cursor);
+    cursor += sizeof(int32_t) * (numVertices + 1);
+    const int32_t *targets = reinterpret_cast<const int32_t *>(cursor);
+    cursor += sizeof(int32_t) * numEdges;
+    const float *weights = reinterpret_cast<const float *>(cursor);
+    cursor += sizeof(float) * numEdges;
+    const char *names = cursor;
+
+    // Validate everything before touching the graph, so a corrupt file cannot leave it half loaded
+    if (nameOffsets[0] != 0 || nameOffsets[numVertices] != header.namesBytes ||
+        edgeOffsets[0] != 0 || edgeOffsets[numVertices] != header.numEdges) {
+        return false;
+    }
+    for (unsigned long long i = 0; i < numVertices; i++) {
+        if (nameOffsets[i] > nameOffsets[i + 1] || edgeOffsets[i] > edgeOffsets[i + 1]) return false;
+    }
+    for (unsigned long long e = 0; e < numEdges; e++) {
+        if (targets[e] < 0 || targets[e] >= header.numVertices) return false;
+    }
+
+    IntersectionIndex loaded;
+    loaded.reserve(header.numVertices);
+    for (int i = 0; i < header.numVertices; i++) {
+        const string_view name(names + nameOffsets[i], nameOffsets[i + 1] - nameOffsets[i]);
+        if (loaded.intern(name) != i) return false; // Duplicate name
+    }
+
+    intersections = std::move(loaded);
+    graph.assignFromCSR(header.numVertices, edgeOffsets, targets, weights);
+    return true;
+}
+
+/**
+ * Loads a road network, preferring its binary form. If the binary file is missing or stale, the CSV file is
+ * parsed with loadRoadNetwork and converted, so the next start can use the binary file.
+ *
+ * @param graph The graph where the road network will be loaded.
+ * @param intersections The index that maps intersection names to vertex indices.
+ * @param csvFileName The road network CSV file.
+ * @param binaryFileName The binary file that caches the converted CSV file.
+ */
+void loadRoadNetworkCached(Graph &graph, IntersectionIndex &intersections, const string &csvFileName,
+                           const string &binaryFileName) {
+    if (loadRoadNetworkBinary(graph, intersections, csvFileName, binaryFileName)) return;
+
+    // Only a network loaded into an empty graph and index can be written back as is
+    const bool convertible = graph.getSize() == 0 && intersections.getSize() == 0;
+    loadRoadNetwork(graph, intersections, csvFileName);
+    if (convertible && graph.getSize() > 0) {
+        writeRoadNetworkBinary(graph, intersections, csvFileName, binaryFileName);
+    }
+}
@@ -0,0 +1,405 @@
+#include <iostream>
+#include <chrono>
+using namespace std;
+
+/**
+ * The counters of a RouteCache, for sizing it.
+ */
+struct RouteCacheStats {
+    /**
+     * Queries answered from the cache.
+     */
+    long long hits;
+    /**
+     * Queries that had to run a search.
+     */
+    long long misses;
+    /**
+     * Routes dropped to make room for a new one.
+     */
+    long long evictions;
+    /**
+     * Routes dropped because a road they use was removed, closed or made slower.
+     */
+    long long invalidations;
+    /**
+     * Times the whole cache was emptied because the graph changed in a way that can shorten any route.
+     */
+    long long flushes;
+    /**
+     * The total time spent in queries that hit, in nanoseconds.
+     */
+    long long hitNanoseconds;
+    /**
+     * The total time spent in queries that missed, including the search, in nanoseconds.
+     */
+    long long missNanoseconds;
+};
+
+/**
+ * A bounded least-recently-used cache of shortest routes in front of dijkstraPath.
+ *
+ * Routes are keyed by (start, end) in an EdgeMap and kept on a recency list; once the cache is full, a new
+ * route evicts the least recently used one. The cache owns the road closures the routes avoid.
+ *
+ * Invalidation is exact where it can be. Removing a road, closing it or raising its weight can only lengthen
+ * the routes through it, so every road points back at the cached routes that use it, and only those are
+ * dropped. Adding a road, lowering a weight or reopening a closed road can make any route shorter, so the
+ * whole cache is flushed instead. The cache learns about graph changes from the graph's version counter and
+ * change journal (Graph::forEachSlowedEdgeSince) at the next query, so callers only need to tell it about
+ * closures.
+ *
+ * Every route returned is a shortest route for the current graph and closures. Where several routes tie, a
+ * cached route may differ from the one a fresh search would pick.
+ *
+ * Not thread-safe: use one cache per thread, or guard it externally.
+ */
+class RouteCache {
+    /**
+     * One use of a road by a cached route. The uses of a road form a doubly linked list, so a route can be
+     * unlinked from every road it uses in O(length of the route).
+     */
+    struct EdgeUse {
+        /**
+         * The slot of the route in entries.
+         */
+        int entry;
+        /**
+         * The neighbouring uses of the same road.
+         */
+        EdgeUse *previous;
+        EdgeUse *next;
+        /**
+         * The use of the next road of the same route, in route order.
+         */
+        EdgeUse *nextInRoute;
+    };
+
+    /**
+     * A cached route and its place on the recency list.
+     */
+    struct CacheEntry {
+        int start;
+        int end;
+        Route path;
+        /**
+         * The neighbouring slots on the recency list (newer is towards the most recently used end), or -1.
+         */
+        int newer;
+        int older;
+        /**
+         * The use of the first road of the route, or nullptr for routes without roads.
+         */
+        EdgeUse *uses;
+    };
+
+    /**
+     * The graph the routes are computed on.
+     */
+    const Graph &graph;
+    /**
+     * The maximum number of routes kept.
+     */
+    int capacity;
+    /**
+     * The slots of the cached routes. Slots of dropped routes are kept for reuse.
+     */
+    Vector<CacheEntry> entries;
+    /**
+     * The slots that hold no route.
+     */
+    Vector<int> freeSlots;
+    /**
+     * Maps (start, end) to the slot of its route.
+     */
+    EdgeMap<int> routeIndex;
+    /**
+     * Maps each road used by a cached route to the first of its uses.
+     */
+    EdgeMap<EdgeUse *> routesByEdge;
+    /**
+     * The storage of every EdgeUse.
+     */
+    NodePool<EdgeUse> edgeUses;
+    /**
+     * The most and least recently used slots, or -1 if the cache is empty.
+     */
+    int newest;
+    int oldest;
+    /**
+     * The road closures the routes avoid, in both directions.
+     */
+    EdgeMap<int> closures;
+    /**
+     * The graph version the cached routes are valid for.
+     */
+    unsigned long long seenVersion;
+    /**
+     * The counters reported by getStats.
+     */
+    RouteCacheStats stats;
+
+    /**
+     * Removes a slot from the recency list.
+     *
+     * @param slot The slot to unlink.
+     */
+    void unlinkRecency(const int slot) {
+        CacheEntry &entry = entries[slot];
+        if (entry.newer != -1) entries[entry.newer].older = entry.older; else newest = entry.older;
+        if (entry.older != -1) entries[entry.older].newer = entry.newer; else oldest = entry.newer;
+    }
+
+    /**
+     * Puts a slot at the most recently used end of the recency list.
+     *
+     * @param slot The slot to link. Must not be on the list.
+     */
+    void linkNewest(const int slot) {
+        CacheEntry &entry = entries[slot];
+        entry.newer = -1;
+        entry.older = newest;
+        if (newest != -1) entries[newest].newer = slot; else oldest = slot;
+        newest = slot;
+    }
+
+    /**
+     * Drops the route in a slot, unlinking it from the index, the recency list and every road it uses.
+     *
+     * @param slot The slot of the route.
+     */
+    void removeEntry(const int slot) {
+        CacheEntry &entry = entries[slot];
+        EdgeUse *use = entry.uses;
+        for (int j = 0; use != nullptr; j++) {
+            EdgeUse *nextUse = use->nextInRoute;
+            if (use->previous != nullptr) {
+                use->previous->next = use->next;
+            } else if (use->next != nullptr) {
+                *routesByEdge.find(entry.path[j], entry.path[j + 1]) = use->next;
+            } else {
+                routesByEdge.erase(entry.path[j], entry.path[j + 1]);
+            }
+            if (use->next != nullptr) {
+                use->next->previous = use->previous;
+            }
+            edgeUses.destroy(use);
+            use = nextUse;
+        }
+
+        unlinkRecency(slot);
+        routeIndex.erase(entry.start, entry.end);
+        entry.path.clear();
+        entry.uses = nullptr;
+        freeSlots.push_back(slot);
+    }
+
+    /**
+     * Stores a route as the most recently used one, evicting the least recently used route if the cache is full.
+     *
+     * @param start The start of the route.
+     * @param end The end of the route.
+     * @param path The route, or an empty route if end cannot be reached.
+     */
+    void addEntry(const int start, const int end, const Route &path) {
+        if (routeIndex.getSize() >= capacity) {
+            removeEntry(oldest);
+            stats.evictions++;
+        }
+
+        int slot;
+        if (!freeSlots.isEmpty()) {
+            slot = freeSlots.pop();
+        } else {
+            slot = entries.getSize();
+            entries.push_back(CacheEntry{-1, -1, Route(), -1, -1, nullptr});
+        }
+
+        CacheEntry &entry = entries[slot];
+        entry.start = start;
+        entry.end = end;
+        entry.path = path;
+
+        // Link the route into the use list of every road it takes, keeping the uses in route order
+        EdgeUse **tail = &entry.uses;
+        for (int j = 0; j + 1 < path.getSize(); j++) {
+            EdgeUse **head = routesByEdge.find(path[j], path[j + 1]);
+            EdgeUse *use = edgeUses.create(EdgeUse{slot, nullptr, head != nullptr ? *head : nullptr, nullptr});
+            if (head != nullptr) {
+                (*head)->previous = use;
+                *head = use;
+            } else {
+                routesByEdge.insert(path[j], path[j + 1], use);
+            }
+            *tail = use;
+            tail = &use->nextInRoute;
+        }
+
+        routeIndex.insert(start, end, slot);
+        linkNewest(slot);
+    }
+
+    /**
+     * Drops every cached route that uses a road.
+     *
+     * @param u The source vertex of the road.
+     * @param v The target vertex of the road.
+     */
+    void invalidateEdge(const int u, const int v) {
+        for (EdgeUse **head = routesByEdge.find(u, v); head != nullptr; head = routesByEdge.find(u, v)) {
+            removeEntry((*head)->entry);
+            stats.invalidations++;
+        }
+    }
+
+    /**
+     * Brings the cache up to date with the graph: drops the routes through roads that were removed or slowed
+     * since the last query, or every route if the graph changed in any other way.
+     */
+    void synchronize() {
+        const unsigned long long version = graph.getVersion();
+        if (version == seenVersion) return;
+        const bool exact = graph.forEachSlowedEdgeSince(seenVersion, [this](const int u, const int v) {
+            invalidateEdge(u, v);
+        });
+        if (!exact) {
+            clear();
+            stats.flushes++;
+        }
+        seenVersion = version;
+    }
+
+public:
+    /**
+     * Constructs an empty cache for a graph.
+     *
+     * @param network The graph to route on. Must outlive the cache.
+     * @param maxRoutes The maximum number of routes kept. Values below 1 are raised to 1.
+     */
+    RouteCache(const Graph &network, const int maxRoutes)
+        : graph(network), capacity(maxRoutes < 1 ? 1 : maxRoutes), newest(-1), oldest(-1),
+          seenVersion(network.getVersion()), stats{0, 0, 0, 0, 0, 0, 0} {}
+
+    RouteCache(const RouteCache &) = delete;
+    RouteCache &operator=(const RouteCache &) = delete;
+
+    /**
+     * Returns the shortest route from start to end avoiding the closures, from the cache if possible.
+     *
+     * @param start The starting node of the route.
+     * @param end The destination node of the route.
+     * @return The route from start to end, or an empty route if there is none.
+     */
+    Route route(const int start, const int end) {
+        const chrono::steady_clock::time_point began = chrono::steady_clock::now();
+        synchronize();
+
+        const int *slot = routeIndex.find(start, end);
+        if (slot != nullptr) {
+            const int hit = *slot;
+            unlinkRecency(hit);
+            linkNewest(hit);
+            Route path = entries[hit].path;
+            stats.hits++;
+            stats.hitNanoseconds += chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - began).count();
+            return path;
+        }
+
+        Route path = dijkstraPath(graph.getSnapshot(), start, end, closures, threadWorkspace());
+        addEntry(start, end, path);
+        stats.misses++;
+        stats.missNanoseconds += chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - began).count();
+        return path;
+    }
+
+    /**
+     * Closes the road between two intersections in both directions and drops the routes that use it.
+     *
+     * @param u The first intersection of the road.
+     * @param v The second intersection of the road.
+     * @param status ROAD_UNDER_REPAIR or ROAD_BLOCKED.
+     */
+    void closeRoad(const int u, const int v, const int status) {
+        closures.insert(u, v, status);
+        closures.insert(v, u, status);
+        invalidateEdge(u, v);
+        invalidateEdge(v, u);
+    }
+
+    /**
+     * Reopens a closed road. Routes through the road may now be shorter than the cached ones, so the cache is
+     * flushed if the road was closed.
+     *
+     * @param u The first intersection of the road.
+     * @param v The second intersection of the road.
+     */
+    void openRoad(const int u, const int v) {
+        const bool forward = closures.erase(u, v);
+        const bool backward = closures.erase(v, u);
+        if (forward || backward) {
+            clear();
+            stats.flushes++;
+        }
+    }
+
+    /**
+     * Applies loaded road closures row by row, like compileRoadClosures: roads under repair or blocked are
+     * closed, roads marked clear are reopened.
+     *
+     * @param roadClosures The closures, each holding two intersections and a status code.
+     */
+    void applyClosures(const ClosureTable &roadClosures) {
+        for (int i = 0; i < roadClosures.getSize(); i++) {
+            int u = roadClosures.getIntersection1(i);
+            int v = roadClosures.getIntersection2(i);
+            int status = roadClosures.getStatus(i);
+            if (status == ROAD_UNDER_REPAIR || status == ROAD_BLOCKED) {
+                closeRoad(u, v, status);
+            } else {
+                openRoad(u, v);
+            }
+        }
+    }
+
+    /**
+     * Drops every cached route. The closures and counters are kept.
+     */
+    void clear() {
+        entries.clear();
+        freeSlots.clear();
+        routeIndex.clear();
+        routesByEdge.clear();
+        edgeUses.release();
+        newest = -1;
+        oldest = -1;
+    }
+
+    /**
+     * Returns the number of routes currently cached.
+     * @return The number of routes.
+     */
+    int getSize() const {
+        return routeIndex.getSize();
+    }
+
+    /**
+     * Returns the counters gathered since the cache was constructed.
+     * @return A copy of the counters.
+     */
+    RouteCacheStats getStats() const {
+        return stats;
+    }
+
+    /**
+     * Displays the hit rate, the average latency of hits and misses and the other counters.
+     */
+    void displayStats() const {
+        const long long queries = stats.hits + stats.misses;
+        cout << "Route cache: " << getSize() << "/" << capacity << " routes, " << queries << " queries, hit rate "
+             << (queries > 0 ? 100.0 * stats.hits / queries : 0.0) << "%" << endl;
+        cout << "Average latency - Hit: " << (stats.hits > 0 ? stats.hitNanoseconds / stats.hits : 0)
+             << " ns - Miss: " << (stats.misses > 0 ? stats.missNanoseconds / stats.misses : 0) << " ns" << endl;
+        cout << "Evictions: " << stats.evictions << " - Invalidations: " << stats.invalidations
+             << " - Flushes: " << stats.flushes << endl;
+    }
+};
@@ -0,0 +1,222 @@
+#include <iostream>
+#include <climits>
+using namespace std;
+
+/**
+ * Represents an infinite distance used in the Dijkstra algorithm.
+ * Initialized to the maximum possible integer value defined by INT_MAX.
+ * Used as the initial distance for vertices to signify they are unvisited or unreachable.
+ */
+constexpr float INF = INT_MAX;
+
+/**
+ * The Dijkstra frontier: an indexed binary min-heap of vertices keyed by tentative distance.
+ * Each vertex is queued at most once and a shorter path lowers its key in place (decrease-key),
+ * so the heap never holds more than V entries and searches run in O((V + E) log V).
+ */
+typedef IndexedMinHeap<float> FrontierHeap;
+
+/**
+ * Scratch state for one shortest-path search, reused across queries to avoid per-query allocation.
+ *
+ * The distance, parent and settled arrays are sized to the graph once and kept between searches. Each
+ * vertex carries the generation of the search that last wrote it. Starting a new search only bumps the
+ * generation, so every entry from earlier searches reads as untouched without being cleared. A short
+ * local query therefore costs time proportional to the area it explores, not to the size of the city.
+ */
+class SearchWorkspace {
+    /**
+     * Tentative distance from the source, valid only where stamp matches the current generation.
+     */
+    Vector<float> distance;
+    /**
+     * Predecessor on the best known path, valid only where stamp matches the current generation.
+     */
+    Vector<int> parent;
+    /**
+     * Whether the vertex has been settled, valid only where stamp matches the current generation.
+     */
+    Vector<bool> settled;
+    /**
+     * Whether the vertex is a destination of the current search, valid only where stamp matches the current generation.
+     */
+    Vector<bool> target;
+    /**
+     * The generation of the search that last touched each vertex.
+     */
+    Vector<unsigned int> stamp;
+    /**
+     * The generation of the current search. Zero is never used, so fresh stamps always read as stale.
+     */
+    unsigned int generation;
+    /**
+     * The priority queue of the current search. Its storage is kept between searches.
+     */
+    FrontierHeap frontier;
+
+    /**
+     * Grows the per-vertex arrays so that vertices [0, numVertices) can be addressed.
+     *
+     * @param numVertices The number of vertices in the graph about to be searched.
+     */
+    void ensureCapacity(const int numVertices) {
+        if (numVertices <= stamp.getSize()) return;
+        distance = Vector<float>(numVertices, INF);
+        parent = Vector<int>(numVertices, -1);
+        settled = Vector<bool>(numVertices, false);
+        target = Vector<bool>(numVertices, false);
+        stamp = Vector<unsigned int>(numVertices, 0);
+        generation = 0;
+        frontier.ensureCapacity(numVertices);
+    }
+
+    /**
+     * Gives the vertex its initial state for the current search if it has not been touched yet.
+     *
+     * @param vertex The vertex to initialise.
+     */
+    void touch(const int vertex) {
+        if (stamp[vertex] != generation) {
+            stamp[vertex] = generation;
+            distance[vertex] = INF;
+            parent[vertex] = -1;
+            settled[vertex] = false;
+            target[vertex] = false;
+        }
+    }
+
+public:
+    /**
+     * Constructs an empty workspace. Storage is allocated by the first call to begin.
+     */
+    SearchWorkspace() : generation(0) {}
+
+    /**
+     * Prepares the workspace for a new search over a graph with the given number of vertices.
+     * Runs in O(1) except when the graph has grown or the generation counter wraps around.
+     *
+     * @param numVertices The number of vertices in the graph to be searched.
+     */
+    void begin(const int numVertices) {
+        ensureCapacity(numVertices);
+        frontier.clear();
+        generation++;
+        if (generation == 0) {
+            // The counter wrapped, so old stamps could be mistaken for current ones
+            for (int i = 0; i < stamp.getSize(); i++) {
+                stamp[i] = 0;
+            }
+            generation = 1;
+        }
+    }
+
+    /**
+     * Returns the tentative distance of a vertex in the current search.
+     *
+     * @param vertex The vertex to query.
+     * @return The best distance found so far, or INF if the vertex has not been reached.
+     */
+    float getDistance(const int vertex) const {
+        return stamp[vertex] == generation ? distance[vertex] : INF;
+    }
+
+    /**
+     * Returns the predecessor of a vertex on its best known path in the current search.
+     *
+     * @param vertex The vertex to query.
+     * @return The predecessor, or -1 if the vertex is the source or has not been reached.
+     */
+    int getParent(const int vertex) const {
+        return stamp[vertex] == generation ? parent[vertex] : -1;
+    }
+
+    /**
+     * Checks whether a vertex has been settled in the current search.
+     *
+     * @param vertex The vertex to query.
+     * @return True if the final distance of the vertex is known, false otherwise.
+     */
+    bool isSettled(const int vertex) const {
+        return stamp[vertex] == generation && settled[vertex];
+    }
+
+    /**
+     * Marks a vertex as settled in the current search.
+     *
+     * @param vertex The vertex whose distance is final.
+     */
+    void settle(const int vertex) {
+        touch(vertex);
+        settled[vertex] = true;
+    }
+
+    /**
+     * Marks a vertex as a destination of the current search, so a one-to-many search can tell when it has
+     * settled every vertex it was asked about.
+     *
+     * @param vertex The destination.
+     * @return True if the vertex was not marked yet, false if it already was.
+     */
+    bool markTarget(const int vertex) {
+        touch(vertex);
+        if (target[vertex]) return false;
+        target[vertex] = true;
+        return true;
+    }
+
+    /**
+     * Checks whether a vertex was marked as a destination of the current search.
+     *
+     * @param vertex The vertex to query.
+     * @return True if markTarget was called for the vertex since the search began.
+     */
+    bool isTarget(const int vertex) const {
+        return stamp[vertex] == generation && target[vertex];
+    }
+
+    /**
+     * Records a shorter path to a vertex and queues it on the frontier, or lowers its key if it is already queued.
+     *
+     * @param vertex The vertex that was reached.
+     * @param newDistance The length of the new path.
+     * @param newParent The predecessor of the vertex on the new path, or -1 for the source.
+     */
+    void relax(const int vertex, const float newDistance, const int newParent) {
+        relax(vertex, newDistance, newParent, newDistance);
+    }
+
+    /**
+     * Records a shorter path to a vertex and queues it on the frontier under a separate key, e.g. the distance
+     * plus a lower bound on the remaining distance for A*.
+     *
+     * @param vertex The vertex that was reached.
+     * @param newDistance The length of the new path.
+     * @param newParent The predecessor of the vertex on the new path, or -1 for the source.
+     * @param key The priority of the vertex on the frontier. Must not exceed its current key if it is queued.
+     */
+    void relax(const int vertex, const float newDistance, const int newParent, const float key) {
+        touch(vertex);
+        distance[vertex] = newDistance;
+        parent[vertex] = newParent;
+        frontier.pushOrDecrease(vertex, key);
+    }
+
+    /**
+     * Provides access to the frontier of the current search.
+     * @return A reference to the frontier heap.
+     */
+    FrontierHeap &getFrontier() {
+        return frontier;
+    }
+};
+
+/**
+ * Returns the search workspace owned by the calling thread.
+ * Each thread gets its own instance, so concurrent searches never share scratch state.
+ *
+ * @return A reference to the calling thread's workspace.
+ */
+SearchWorkspace &threadWorkspace() {
+    thread_local SearchWorkspace workspace;
+    return workspace;
+}
@@ -0,0 +1,460 @@
+#include <iostream>
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <new>
+#include <utility>
+using namespace std;
+
+template<typename T, int N>
+/**
+ * A dynamic array with room for N elements inside the object itself.
+ *
+ * Up to N elements are stored inline without touching the heap; only when the vector grows past that does it
+ * spill its elements into heap storage, after which it behaves exactly like Vector. It offers the same interface
+ * as Vector, so it can stand in for it wherever most instances stay small, such as fixed-width dataset records
+ * and short routes.
+ *
+ * @tparam T Type of the stored elements.
+ * @tparam N The number of elements stored inline. Must be at least 1.
+ */
+class SmallVector {
+    /**
+     * Raw storage for the first N elements, used as long as the vector has not spilled to the heap.
+     */
+    alignas(T) unsigned char inlineStorage[sizeof(T) * N];
+    /**
+     * Pointer to the elements: either inlineStorage or a heap block. Slots at or beyond size are unconstructed.
+     */
+    T *data;
+    /**
+     * The number of elements data can hold without reallocating. Equals N while the storage is inline.
+     */
+    int capacity;
+    /**
+     * Represents the current number of elements stored in the SmallVector.
+     */
+    int size;
+
+    /**
+     * Returns the inline storage as an element pointer.
+     *
+     * @return Pointer to the first inline slot.
+     */
+    T *inlineData() {
+        return reinterpret_cast<T *>(inlineStorage);
+    }
+
+    /**
+     * Destroys every live element and releases heap storage, returning the vector to its empty inline state.
+     */
+    void reset() {
+        clear();
+        if (!isInline()) {
+            ::operator delete(data);
+        }
+        data = inlineData();
+        capacity = N;
+    }
+
+    /**
+     * Moves the live elements into the given storage and releases the old storage if it was on the heap.
+     *
+     * @param newData Storage for at least size elements: either inlineData() or a block from ::operator new.
+     * @param newCapacity The number of elements newData can hold.
+     */
+    void relocate(T *newData, const int newCapacity) {
+        for (int i = 0; i < size; i++) {
+            new (newData + i) T(std::move(data[i]));
+            data[i].~T();
+        }
+        if (!isInline()) {
+            ::operator delete(data);
+        }
+        data = newData;
+        capacity = newCapacity;
+    }
+
+    /**
+     * Moves the elements into a heap block of the given capacity.
+     *
+     * @param newCapacity The new capacity. Must be larger than N and at least the current size.
+     */
+    void resize(const int newCapacity) {
+        relocate(static_cast<T *>(::operator new(sizeof(T) * newCapacity)), newCapacity);
+    }
+
+    /**
+     * Takes over the contents of another SmallVector, which must be empty-initialised on this side.
+     * Heap storage is stolen; inline elements are moved one by one.
+     *
+     * @param other The SmallVector to move from. It is left empty.
+     */
+    void takeFrom(SmallVector &other) {
+        if (other.isInline()) {
+            for (int i = 0; i < other.size; i++) {
+                new (data + i) T(std::move(other.data[i]));
+            }
+            size = other.size;
+            other.clear();
+        } else {
+            data = other.data;
+            capacity = other.capacity;
+            size = other.size;
+            other.data = other.inlineData();
+            other.capacity = N;
+            other.size = 0;
+        }
+    }
+
+    /**
+     * Constructs an empty SmallVector using only its inline storage.
+     */
+public:
+    SmallVector() : data(inlineData()), capacity(N), size(0) {}
+
+    /**
+     * Constructs a SmallVector with the specified initial size, each element initialised to the default value of T.
+     *
+     * @param initialSize The initial number of elements.
+     */
+    explicit SmallVector(const int initialSize) : SmallVector() {
+        reserve(initialSize);
+        for (int i = 0; i < initialSize; i++) {
+            new (data + i) T();
+        }
+        size = initialSize;
+    }
+
+    /**
+     * Constructs a SmallVector with the specified initial size, filling every element with a copy of value.
+     *
+     * @param initialSize The initial number of elements.
+     * @param value The value every element is initialised to.
+     */
+    SmallVector(const int initialSize, const T &value) : SmallVector() {
+        reserve(initialSize);
+        for (int i = 0; i < initialSize; i++) {
+            new (data + i) T(value);
+        }
+        size = initialSize;
+    }
+
+    /**
+     * Destroys the elements and releases heap storage, if any.
+     */
+    ~SmallVector() {
+        reset();
+    }
+
+    /**
+     * Copy constructor. Copies the elements of another SmallVector, staying inline when they fit.
+     *
+     * @param other The SmallVector to copy from.
+     */
+    SmallVector(const SmallVector &other) : SmallVector() {
+        reserve(other.size);
+        for (int i = 0; i < other.size; i++) {
+            new (data + i) T(other.data[i]);
+        }
+        size = other.size;
+    }
+
+    /**
+     * Move constructor. Steals the heap storage of another SmallVector, or moves its inline elements.
+     *
+     * @param other The SmallVector to move from. It is left empty.
+     */
+    SmallVector(SmallVector &&other) noexcept : SmallVector() {
+        takeFrom(other);
+    }
+
+    /**
+     * Replaces the contents with a copy of another SmallVector, reusing the current storage when it is large enough.
+     *
+     * @param other The SmallVector to copy from.
+     * @return A reference to this SmallVector.
+     */
+    SmallVector &operator=(const SmallVector &other) {
+        if (this == &other) return *this;
+        clear();
+        reserve(other.size);
+        for (int i = 0; i < other.size; i++) {
+            new (data + i) T(other.data[i]);
+        }
+        size = other.size;
+        return *this;
+    }
+
+    /**
+     * Replaces the contents with those of another SmallVector, leaving it empty.
+     *
+     * @param other The SmallVector to move from.
+     * @return A reference to this SmallVector.
+     */
+    SmallVector &operator=(SmallVector &&other) noexcept {
+        if (this == &other) return *this;
+        reset();
+        takeFrom(other);
+        return *this;
+    }
+
+    /**
+     * Provides access to the element at the specified index.
+     *
+     * @param index The index of the element to be accessed. Must be within the range [0, size - 1].
+     * @return A reference to the element at the given index.
+     * @throws Exits the program with an error message if the index is out of range.
+     */
+    T &operator[](int index) {
+        if (index < 0 || index >= size) {
+            cout << "Index out of range" << endl;
+            exit(1);
+        }
+        return data[index];
+    }
+
+    /**
+     * Returns a const reference to the element at the specified index.
+     * If the index is out of range, prints an error message and exits.
+     *
+     * @param index The index of the element to retrieve. Must be in the range [0, size).
+     * @return A const reference to the element at the specified index.
+     */
+    const T &operator[](int index) const {
+        if (index < 0 || index >= size) {
+            cout << "Index out of range" << endl;
+            exit(1);
+        }
+        return data[index];
+    }
+
+    /**
+     * Iterator types. The elements are contiguous whether inline or on the heap, so plain pointers serve as
+     * random-access iterators. Adding elements may move them (also when spilling from inline storage) and
+     * invalidate every iterator; so does moving the SmallVector while its elements are inline.
+     */
+    typedef T *iterator;
+    typedef const T *const_iterator;
+
+    /**
+     * Returns an iterator to the first element.
+     * @return An iterator to the first element.
+     */
+    iterator begin() { return data; }
+
+    /**
+     * Returns an iterator one past the last element.
+     * @return An iterator one past the last element.
+     */
+    iterator end() { return data + size; }
+
+    /**
+     * Returns a read-only iterator to the first element.
+     * @return A read-only iterator to the first element.
+     */
+    const_iterator begin() const { return data; }
+
+    /**
+     * Returns a read-only iterator one past the last element.
+     * @return A read-only iterator one past the last element.
+     */
+    const_iterator end() const { return data + size; }
+
+    /**
+     * Returns the current number of elements in the vector.
+     * @return The size of the vector.
+     */
+    int getSize() const { return size; }
+
+    /**
+     * Returns the current capacity of the vector. Never less than N.
+     *
+     * @return The capacity of the vector.
+     */
+    int getCapacity() const { return capacity; }
+
+    /**
+     * Checks if the vector is empty.
+     * @return True if the vector contains no elements, false otherwise.
+     */
+    bool isEmpty() const { return size == 0; }
+
+    /**
+     * Checks whether the elements are still held in the inline storage.
+     * @return True if no heap storage is in use, false otherwise.
+     */
+    bool isInline() const { return data == reinterpret_cast<const T *>(inlineStorage); }
+
+    /**
+     * Ensures the vector can hold at least the given number of elements without reallocating.
+     *
+     * @param newCapacity The minimum capacity required. Values up to the current capacity leave the vector unchanged.
+     */
+    void reserve(const int newCapacity) {
+        if (newCapacity > capacity) {
+            resize(newCapacity);
+        }
+    }
+
+    /**
+     * Releases unused heap capacity, moving the elements back inline when they fit.
+     */
+    void shrink_to_fit() {
+        if (isInline() || capacity == size) return;
+        if (size <= N) {
+            relocate(inlineData(), N);
+        } else {
+            resize(size);
+        }
+    }
+
+    /**
+     * Constructs a new element in place at the end of the vector from the given constructor arguments.
+     * If the vector is full, its capacity is doubled and the elements spill to (or grow on) the heap.
+     *
+     * @param args The arguments forwarded to T's constructor. They may refer to an element of this vector.
+     * @return A reference to the new element.
+     */
+    template<typename... Args>
+    T &emplace_back(Args &&... args) {
+        if (size == capacity) {
+            const int newCapacity = capacity * 2;
+            T *newData = static_cast<T *>(::operator new(sizeof(T) * newCapacity));
+            // Build the new element before moving the old ones, in case args refer into this vector
+            new (newData + size) T(std::forward<Args>(args)...);
+            relocate(newData, newCapacity);
+        } else {
+            new (data + size) T(std::forward<Args>(args)...);
+        }
+        return data[size++];
+    }
+
+    /**
+     * Adds a new element to the end of the vector.
+     *
+     * @param value The element to be added to the end of the vector.
+     */
+    void push_back(const T &value) {
+        emplace_back(value);
+    }
+
+    /**
+     * Moves a new element onto the end of the vector.
+     *
+     * @param value The element to be moved to the end of the vector.
+     */
+    void push_back(T &&value) {
+        emplace_back(std::move(value));
+    }
+
+    /**
+     * Removes the last element from the vector and returns it. If the vector is empty,
+     * the operation results in termination of the program.
+     * @return The last element in the vector.
+     */
+    T pop() {
+        if (isEmpty()) {
+            cout << "Pop from empty vector" << endl;
+            exit(1);
+        }
+        T value = std::move(data[size - 1]);
+        data[--size].~T();
+        return value;
+    }
+
+    /**
+     * Inserts a value at the specified index. The elements at the specified index and beyond are shifted to the right.
+     *
+     * @param index Position at which the value should be inserted. Must be between 0 and the current size, inclusive.
+     * @param value The value to insert into the vector.
+     */
+    void insert(int index, const T &value) {
+        if (index < 0 || index > size) {
+            cout << "Index out of range" << endl;
+            exit(1);
+        }
+        if (index == size) {
+            emplace_back(value);
+            return;
+        }
+        T copy(value);
+        if (size == capacity) {
+            resize(capacity * 2);
+        }
+        new (data + size) T(std::move(data[size - 1]));
+        for (int i = size - 1; i > index; i--) {
+            data[i] = std::move(data[i - 1]);
+        }
+        data[index] = std::move(copy);
+        size++;
+    }
+
+    /**
+     * Removes the element at the specified index from the vector.
+     *
+     * @param index The index of the element to be removed. Must be in the range [0, size-1],
+     *              otherwise the program will terminate with an error message.
+     */
+    void erase(const int index) {
+        if (index < 0 || index >= size) {
+            cout << "Index out of range" << endl;
+            exit(1);
+        }
+        for (int i = index; i < size - 1; i++) {
+            data[i] = std::move(data[i + 1]);
+        }
+        data[--size].~T();
+    }
+
+    /**
+     * Clears the contents of the vector, destroying every element and setting the size to zero.
+     * The capacity, inline or on the heap, remains unchanged.
+     */
+    void clear() {
+        for (int i = 0; i < size; i++) {
+            data[i].~T();
+        }
+        size = 0;
+    }
+
+    /**
+     * Reverses the order of the elements in the vector in place.
+     */
+    void reverse() {
+        std::reverse(begin(), end());
+    }
+
+    /**
+     * Searches for the first occurrence of the specified value in the vector.
+     * @param value The value to search for within the vector.
+     * @return The index of the first occurrence of the value if found; otherwise, -1.
+     */
+    int find(const T &value) const {
+        const_iterator found = std::find(begin(), end(), value);
+        return found == end() ? -1 : static_cast<int>(found - begin());
+    }
+
+    /**
+     * Checks whether a specified value exists in the vector.
+     *
+     * @param value The value to search for within the vector.
+     * @return True if the vector contains the value, false otherwise.
+     */
+    bool contains(const T &value) const {
+        return find(value) != -1;
+    }
+
+    /**
+     * Displays the elements of the vector in a comma-separated format enclosed in square brackets.
+     */
+    void display() const {
+        cout << "[";
+        for (int i = 0; i < size; i++) {
+            cout << data[i];
+            if (i < size - 1) cout << ", ";
+        }
+        cout << "]" << endl;
+    }
+};
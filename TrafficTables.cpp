@@ -0,0 +1,421 @@
+#include <iostream>
+#include <string>
+#include <fstream>
+#include <sstream>
+using namespace std;
+
+/**
+ * The vehicles loaded from vehicles.csv, stored column by column.
+ *
+ * Each field lives in its own contiguous array (struct of arrays), so a vehicle costs 12 bytes and no heap
+ * allocation of its own, and a loop that only needs the start and end intersections reads nothing else.
+ * Rows are addressed by their position in the file, starting at 0.
+ */
+class VehicleTable {
+    /**
+     * The number in each vehicle's ID, e.g. 12 for "V12".
+     */
+    Vector<int> ids;
+    /**
+     * The vertex index of each vehicle's start intersection.
+     */
+    Vector<int> starts;
+    /**
+     * The vertex index of each vehicle's end intersection.
+     */
+    Vector<int> ends;
+
+public:
+    /**
+     * Returns the number of vehicles.
+     * @return The number of rows.
+     */
+    int getSize() const {
+        return ids.getSize();
+    }
+
+    /**
+     * Makes room for the given total number of vehicles, so appending that many does not reallocate.
+     *
+     * @param count The number of rows to make room for.
+     */
+    void reserve(const int count) {
+        ids.reserve(count);
+        starts.reserve(count);
+        ends.reserve(count);
+    }
+
+    /**
+     * Appends a vehicle.
+     *
+     * @param id The number in the vehicle's ID.
+     * @param start The vertex index of the start intersection.
+     * @param end The vertex index of the end intersection.
+     */
+    void append(const int id, const int start, const int end) {
+        ids.push_back(id);
+        starts.push_back(start);
+        ends.push_back(end);
+    }
+
+    /**
+     * Appends a range of rows of another table, copying each column in one pass.
+     *
+     * @param other The table to copy from. Must not be this table.
+     * @param first The first row to copy.
+     * @param count The number of rows to copy.
+     */
+    void appendRows(const VehicleTable &other, const int first, const int count) {
+        ids.append(other.ids.begin() + first, other.ids.begin() + first + count);
+        starts.append(other.starts.begin() + first, other.starts.begin() + first + count);
+        ends.append(other.ends.begin() + first, other.ends.begin() + first + count);
+    }
+
+    /**
+     * Rewrites the intersection columns of the rows from a given row on, e.g. to replace placeholder indices
+     * once the names they stand for have been interned.
+     *
+     * @param first The first row to rewrite.
+     * @param remap Called with each start and end index; returns the index to store instead.
+     */
+    template<typename Remap>
+    void remapIntersections(const int first, Remap remap) {
+        for (int i = first; i < getSize(); i++) {
+            starts[i] = remap(starts[i]);
+            ends[i] = remap(ends[i]);
+        }
+    }
+
+    /**
+     * Returns the ID of a vehicle.
+     *
+     * @param row The row of the vehicle. Must be in the range [0, getSize()).
+     * @return The number in the vehicle's ID.
+     */
+    int getId(const int row) const {
+        return ids[row];
+    }
+
+    /**
+     * Returns the start intersection of a vehicle.
+     *
+     * @param row The row of the vehicle. Must be in the range [0, getSize()).
+     * @return The vertex index of the start intersection.
+     */
+    int getStart(const int row) const {
+        return starts[row];
+    }
+
+    /**
+     * Returns the end intersection of a vehicle.
+     *
+     * @param row The row of the vehicle. Must be in the range [0, getSize()).
+     * @return The vertex index of the end intersection.
+     */
+    int getEnd(const int row) const {
+        return ends[row];
+    }
+
+    /**
+     * Returns the start column, for scans over every vehicle without bounds checks.
+     * @return A pointer to getSize() start indices, valid until the table changes.
+     */
+    const int *getStarts() const {
+        return starts.begin();
+    }
+
+    /**
+     * Returns the end column, for scans over every vehicle without bounds checks.
+     * @return A pointer to getSize() end indices, valid until the table changes.
+     */
+    const int *getEnds() const {
+        return ends.begin();
+    }
+};
+
+/**
+ * The emergency vehicles loaded from emergency_vehicles.csv, stored column by column like VehicleTable.
+ */
+class EmergencyVehicleTable {
+    /**
+     * The number in each vehicle's ID, e.g. 3 for "EV3".
+     */
+    Vector<int> ids;
+    /**
+     * The vertex index of each vehicle's start intersection.
+     */
+    Vector<int> starts;
+    /**
+     * The vertex index of each vehicle's end intersection.
+     */
+    Vector<int> ends;
+    /**
+     * The priority of each vehicle: 0 for none, 1 for Medium, 2 for High.
+     */
+    Vector<int> priorities;
+
+public:
+    /**
+     * Returns the number of emergency vehicles.
+     * @return The number of rows.
+     */
+    int getSize() const {
+        return ids.getSize();
+    }
+
+    /**
+     * Makes room for the given total number of emergency vehicles, so appending that many does not reallocate.
+     *
+     * @param count The number of rows to make room for.
+     */
+    void reserve(const int count) {
+        ids.reserve(count);
+        starts.reserve(count);
+        ends.reserve(count);
+        priorities.reserve(count);
+    }
+
+    /**
+     * Appends an emergency vehicle.
+     *
+     * @param id The number in the vehicle's ID.
+     * @param start The vertex index of the start intersection.
+     * @param end The vertex index of the end intersection.
+     * @param priority The priority level.
+     */
+    void append(const int id, const int start, const int end, const int priority) {
+        ids.push_back(id);
+        starts.push_back(start);
+        ends.push_back(end);
+        priorities.push_back(priority);
+    }
+
+    /**
+     * Appends a range of rows of another table, copying each column in one pass.
+     *
+     * @param other The table to copy from. Must not be this table.
+     * @param first The first row to copy.
+     * @param count The number of rows to copy.
+     */
+    void appendRows(const EmergencyVehicleTable &other, const int first, const int count) {
+        ids.append(other.ids.begin() + first, other.ids.begin() + first + count);
+        starts.append(other.starts.begin() + first, other.starts.begin() + first + count);
+        ends.append(other.ends.begin() + first, other.ends.begin() + first + count);
+        priorities.append(other.priorities.begin() + first, other.priorities.begin() + first + count);
+    }
+
+    /**
+     * Rewrites the intersection columns of the rows from a given row on.
+     *
+     * @param first The first row to rewrite.
+     * @param remap Called with each start and end index; returns the index to store instead.
+     */
+    template<typename Remap>
+    void remapIntersections(const int first, Remap remap) {
+        for (int i = first; i < getSize(); i++) {
+            starts[i] = remap(starts[i]);
+            ends[i] = remap(ends[i]);
+        }
+    }
+
+    /**
+     * Returns the ID of an emergency vehicle.
+     *
+     * @param row The row of the vehicle. Must be in the range [0, getSize()).
+     * @return The number in the vehicle's ID.
+     */
+    int getId(const int row) const {
+        return ids[row];
+    }
+
+    /**
+     * Returns the start intersection of an emergency vehicle.
+     *
+     * @param row The row of the vehicle. Must be in the range [0, getSize()).
+     * @return The vertex index of the start intersection.
+     */
+    int getStart(const int row) const {
+        return starts[row];
+    }
+
+    /**
+     * Returns the end intersection of an emergency vehicle.
+     *
+     * @param row The row of the vehicle. Must be in the range [0, getSize()).
+     * @return The vertex index of the end intersection.
+     */
+    int getEnd(const int row) const {
+        return ends[row];
+    }
+
+    /**
+     * Returns the priority of an emergency vehicle.
+     *
+     * @param row The row of the vehicle. Must be in the range [0, getSize()).
+     * @return 0 for none, 1 for Medium, 2 for High.
+     */
+    int getPriority(const int row) const {
+        return priorities[row];
+    }
+
+    /**
+     * Returns the start column, for scans over every vehicle without bounds checks.
+     * @return A pointer to getSize() start indices, valid until the table changes.
+     */
+    const int *getStarts() const {
+        return starts.begin();
+    }
+
+    /**
+     * Returns the end column, for scans over every vehicle without bounds checks.
+     * @return A pointer to getSize() end indices, valid until the table changes.
+     */
+    const int *getEnds() const {
+        return ends.begin();
+    }
+};
+
+/**
+ * The road closures loaded from road_closures.csv, stored column by column.
+ */
+class ClosureTable {
+    /**
+     * The vertex index of the first intersection of each road.
+     */
+    Vector<int> intersections1;
+    /**
+     * The vertex index of the second intersection of each road.
+     */
+    Vector<int> intersections2;
+    /**
+     * The status of each road: ROAD_CLEAR, ROAD_UNDER_REPAIR or ROAD_BLOCKED.
+     */
+    Vector<int> statuses;
+
+public:
+    /**
+     * Returns the number of closures.
+     * @return The number of rows.
+     */
+    int getSize() const {
+        return statuses.getSize();
+    }
+
+    /**
+     * Makes room for the given total number of closures, so appending that many does not reallocate.
+     *
+     * @param count The number of rows to make room for.
+     */
+    void reserve(const int count) {
+        intersections1.reserve(count);
+        intersections2.reserve(count);
+        statuses.reserve(count);
+    }
+
+    /**
+     * Appends a closure.
+     *
+     * @param intersection1 The vertex index of the first intersection.
+     * @param intersection2 The vertex index of the second intersection.
+     * @param status The status code of the road.
+     */
+    void append(const int intersection1, const int intersection2, const int status) {
+        intersections1.push_back(intersection1);
+        intersections2.push_back(intersection2);
+        statuses.push_back(status);
+    }
+
+    /**
+     * Returns the first intersection of a closed road.
+     *
+     * @param row The row of the closure. Must be in the range [0, getSize()).
+     * @return The vertex index of the first intersection.
+     */
+    int getIntersection1(const int row) const {
+        return intersections1[row];
+    }
+
+    /**
+     * Returns the second intersection of a closed road.
+     *
+     * @param row The row of the closure. Must be in the range [0, getSize()).
+     * @return The vertex index of the second intersection.
+     */
+    int getIntersection2(const int row) const {
+        return intersections2[row];
+    }
+
+    /**
+     * Returns the status of a road.
+     *
+     * @param row The row of the closure. Must be in the range [0, getSize()).
+     * @return ROAD_CLEAR, ROAD_UNDER_REPAIR or ROAD_BLOCKED.
+     */
+    int getStatus(const int row) const {
+        return statuses[row];
+    }
+};
+
+/**
+ * The traffic signals loaded from traffic_signals.csv, stored column by column.
+ */
+class SignalTable {
+    /**
+     * The vertex index of each signal's intersection.
+     */
+    Vector<int> intersections;
+    /**
+     * The green time of each signal, in seconds.
+     */
+    Vector<int> greenTimes;
+
+public:
+    /**
+     * Returns the number of signals.
+     * @return The number of rows.
+     */
+    int getSize() const {
+        return intersections.getSize();
+    }
+
+    /**
+     * Makes room for the given total number of signals, so appending that many does not reallocate.
+     *
+     * @param count The number of rows to make room for.
+     */
+    void reserve(const int count) {
+        intersections.reserve(count);
+        greenTimes.reserve(count);
+    }
+
+    /**
+     * Appends a signal.
+     *
+     * @param intersection The vertex index of the intersection.
+     * @param greenTime The green time in seconds.
+     */
+    void append(const int intersection, const int greenTime) {
+        intersections.push_back(intersection);
+        greenTimes.push_back(greenTime);
+    }
+
+    /**
+     * Returns the intersection of a signal.
+     *
+     * @param row The row of the signal. Must be in the range [0, getSize()).
+     * @return The vertex index of the intersection.
+     */
+    int getIntersection(const int row) const {
+        return intersections[row];
+    }
+
+    /**
+     * Returns the green time of a signal.
+     *
+     * @param row The row of the signal. Must be in the range [0, getSize()).
+     * @return The green time in seconds.
+     */
+    int getGreenTime(const int row) const {
+        return greenTimes[row];
+    }
+};
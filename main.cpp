@@ -2,48 +2,71 @@
 #include <string>
 #include <fstream>
 #include <sstream>
+#include <climits>
 
 #include "Vector.cpp"
+#include "Parallel.cpp"
+#include "SmallVector.cpp"
+#include "MappedFile.cpp"
+#include "CsvReader.cpp"
+#include "NodePool.cpp"
+#include "EdgeMap.cpp"
 #include "List.cpp"
+#include "CSRGraph.cpp"
+#include "IntersectionIndex.cpp"
 #include "Queue.cpp"
+#include "Stack.cpp"
 #include "Graph.cpp"
+#include "TrafficTables.cpp"
 #include "ParseFiles.cpp"
+#include "RoadNetworkFile.cpp"
 #include "MinHeap.cpp"
+#include "IndexedMinHeap.cpp"
+#include "PriorityQueue.cpp"
+#include "HashTable.cpp"
+#include "ConcurrentHashTable.cpp"
+#include "SearchWorkspace.cpp"
+#include "Dijkstra.cpp"
+#include "Astar.cpp"
+#include "Congestion.cpp"
+#include "RouteCache.cpp"
 using namespace std;
 
 int main() {
-    Graph graph(26);
-    Vector<Vector<int>> vehicles;
-    Vector<Vector<int>> trafficSignals;
-    Vector<Vector<int>> roadClosures;
-    Vector<Vector<int>> emergencyVehicles;
+    Graph graph(0);
+    IntersectionIndex intersections;
+    VehicleTable vehicles;
+    SignalTable trafficSignals;
+    ClosureTable roadClosures;
+    EmergencyVehicleTable emergencyVehicles;
 
     string roadNetworkFile = "road_network.csv";
+    string roadNetworkBinaryFile = "road_network.bin";
     string vehiclesFile = "vehicles.csv";
     string trafficSignalsFile = "traffic_signals.csv";
     string roadClosuresFile = "road_closures.csv";
     string emergencyVehiclesFile = "emergency_vehicles.csv";
 
     cout << "Loading road network from " << roadNetworkFile << "..." << endl;
-    loadRoadNetwork(graph, roadNetworkFile);
+    loadRoadNetworkCached(graph, intersections, roadNetworkFile, roadNetworkBinaryFile);
     cout << "Road network loaded successfully.\n" << endl;
 
     int numVehicles = INT_MAX;
     cout << "Loading vehicles from " << vehiclesFile << "..." << endl;
-    loadVehicles(vehicles, vehiclesFile, numVehicles);
+    loadVehicles(vehicles, intersections, vehiclesFile, numVehicles);
     cout << "Vehicles loaded successfully.\n" << endl;
 
     cout << "Loading traffic signals from " << trafficSignalsFile << "..." << endl;
-    loadTrafficSignals(trafficSignals, trafficSignalsFile);
+    loadTrafficSignals(trafficSignals, intersections, trafficSignalsFile);
     cout << "Traffic signals loaded successfully.\n" << endl;
 
     cout << "Loading road closures from " << roadClosuresFile << "..." << endl;
-    loadRoadClosures(roadClosures, roadClosuresFile);
+    loadRoadClosures(roadClosures, intersections, roadClosuresFile);
     cout << "Road closures loaded successfully.\n" << endl;
 
     int numEmergencyVehicles = INT_MAX;
     cout << "Loading emergency vehicles from " << emergencyVehiclesFile << "..." << endl;
-    loadEmergencyVehicles(emergencyVehicles, emergencyVehiclesFile, numEmergencyVehicles);
+    loadEmergencyVehicles(emergencyVehicles, intersections, emergencyVehiclesFile, numEmergencyVehicles);
     cout << "Emergency vehicles loaded successfully.\n" << endl;
 
     cout << "====== ROAD NETWORK ======" << endl;
@@ -51,34 +74,38 @@ int main() {
 
     cout << "\n====== VEHICLES ======" << endl;
     for (int i = 0; i < vehicles.getSize(); i++) {
-        cout << "Vehicle " << i + 1 << ": ";
-        for (int j = 0; j < vehicles[i].getSize(); j++) {
-            cout << vehicles[i][j] << " ";
-        }
-        cout << endl;
+        cout << "Vehicle " << i + 1 << ": " << vehicles.getId(i) << " " << vehicles.getStart(i) << " "
+             << vehicles.getEnd(i) << " " << endl;
     }
 
     cout << "\n====== TRAFFIC SIGNALS ======" << endl;
     for (int i = 0; i < trafficSignals.getSize(); i++) {
-        cout << "Intersection: " << trafficSignals[i][0]
-             << ", Green Time: " << trafficSignals[i][1] << endl;
+        cout << "Intersection: " << trafficSignals.getIntersection(i)
+             << ", Green Time: " << trafficSignals.getGreenTime(i) << endl;
     }
 
     cout << "\n====== ROAD CLOSURES ======" << endl;
     for (int i = 0; i < roadClosures.getSize(); i++) {
-        cout << "Intersection 1: " << roadClosures[i][0]
-             << ", Intersection 2: " << roadClosures[i][1]
-             << ", Status: " << roadClosures[i][2] << endl;
+        cout << "Intersection 1: " << roadClosures.getIntersection1(i)
+             << ", Intersection 2: " << roadClosures.getIntersection2(i)
+             << ", Status: " << roadClosures.getStatus(i) << endl;
     }
 
     cout << "\n====== EMERGENCY VEHICLES ======" << endl;
     for (int i = 0; i < emergencyVehicles.getSize(); i++) {
-        cout << "Vehicle ID: " << emergencyVehicles[i][0]
-             << ", Start: " << emergencyVehicles[i][1]
-             << ", End: " << emergencyVehicles[i][2]
-             << ", Priority: " << emergencyVehicles[i][3] << endl;
+        cout << "Vehicle ID: " << emergencyVehicles.getId(i)
+             << ", Start: " << emergencyVehicles.getStart(i)
+             << ", End: " << emergencyVehicles.getEnd(i)
+             << ", Priority: " << emergencyVehicles.getPriority(i) << endl;
     }
 
+    cout << "\n====== CONGESTION ======" << endl;
+    ConcurrentHashTable hashTable;
+    populateCongestionHashTable(graph, vehicles, emergencyVehicles, roadClosures, trafficSignals, hashTable, intersections);
+
+    cout << "\n====== EMERGENCY ROUTING ======" << endl;
+    compareEmergencyRouting(graph, emergencyVehicles, roadClosures);
+
     cout << "\nAll tests completed successfully!" << endl;
 
     return 0;